@@ -89,6 +89,7 @@ workspace "Helios-Project"
 		dir_group = ("helios" .. "/")
 		include("projects/helios-engine/")
 		include("projects/apps/sandbox/")
+		include("projects/apps/helios-bench/")
 	group "Apps"
 		dir_group = ("apps" .. "/")
 		include("projects/apps/template/")
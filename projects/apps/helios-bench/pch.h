@@ -0,0 +1,3 @@
+#pragma once
+
+#include <Helios/Engine/Engine.h>
@@ -0,0 +1,228 @@
+//==============================================================================
+// Benchmark Harness (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Bench.h
+//==============================================================================
+#include "pch.h"
+#include "Bench.h"
+
+#include <Helios/Engine/Core/Clock.h>
+
+#include <cmath>
+#include <ctime>
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+	namespace {
+
+		double Median(std::vector<double> values)
+		{
+			if (values.empty())
+				return 0.0;
+
+			std::sort(values.begin(), values.end());
+			size_t mid = values.size() / 2;
+			return (values.size() % 2) ? values[mid] : 0.5 * (values[mid - 1] + values[mid]);
+		}
+
+
+		std::string JsonEscape(std::string_view text)
+		{
+			std::string out;
+			out.reserve(text.size());
+			for (char c : text) {
+				switch (c) {
+					case '"':  out += "\\\""; break;
+					case '\\': out += "\\\\"; break;
+					case '\n': out += "\\n";  break;
+					case '\t': out += "\\t";  break;
+					default:
+						if (static_cast<unsigned char>(c) < 0x20)
+							out += fmt::format("\\u{:04x}", c);
+						else
+							out += c;
+				}
+			}
+			return out;
+		}
+
+	} // anonymous namespace
+
+
+	void BenchRunner::Add(const std::string& name, BenchFunc func, std::vector<std::pair<std::string, double>> params)
+	{
+		m_Entries.push_back({ name, std::move(func), nullptr, nullptr, std::move(params) });
+	}
+
+
+	void BenchRunner::AddStep(std::function<void()> step)
+	{
+		m_Entries.push_back({ {}, nullptr, std::move(step), nullptr, {} });
+	}
+
+
+	void BenchRunner::AddCheck(const std::string& name, CheckFunc check)
+	{
+		m_Entries.push_back({ name, nullptr, nullptr, std::move(check), {} });
+	}
+
+
+	uint32_t BenchRunner::GetFailedCheckCount() const
+	{
+		return static_cast<uint32_t>(std::count_if(m_CheckResults.begin(), m_CheckResults.end(),
+			[](const CheckResult& check) { return !check.Failure.empty(); }));
+	}
+
+
+	void BenchRunner::Run()
+	{
+		m_Results.clear();
+		m_CheckResults.clear();
+
+		for (const auto& entry : m_Entries)
+		{
+			// Steps always run, the benchmarks after them depend on their state
+			if (entry.Step) {
+				entry.Step();
+				continue;
+			}
+
+			if (!m_Options.Filter.empty() && entry.Name.find(m_Options.Filter) == std::string::npos)
+				continue;
+
+			if (entry.Check) {
+				CheckResult check;
+				check.Name = entry.Name;
+				try {
+					check.Failure = entry.Check();
+				}
+				catch (const std::exception& e) {
+					check.Failure = fmt::format("exception: {}", e.what());
+				}
+				if (check.Failure.empty())
+					LOG_INFO("Bench: {:<40} passed", check.Name);
+				else
+					LOG_ERROR("Bench: {:<40} FAILED: {}", check.Name, check.Failure);
+				m_CheckResults.push_back(std::move(check));
+				continue;
+			}
+
+			Result result = Measure(entry.Name, entry.Func);
+			result.Params = entry.Params;
+
+			LOG_INFO("Bench: {:<40} {:>12.2f} ns/op  (MAD {:.2f}, {} x {} iterations)",
+				result.Name, result.Median, result.MAD, result.Samples, result.Iterations);
+			m_Results.push_back(std::move(result));
+		}
+	}
+
+
+	double BenchRunner::RunSample(const BenchFunc& func, uint64_t iterations)
+	{
+		uint64_t start = HE::Clock::Now();
+		func(iterations);
+		return HE::Clock::TicksToSeconds(HE::Clock::Now() - start);
+	}
+
+
+	BenchRunner::Result BenchRunner::Measure(const std::string& name, const BenchFunc& func)
+	{
+		const double sampleTime = std::max(m_Options.SampleTime, 1e-4);
+
+		// Calibrate: grow the iteration count until a sample is long enough to time reliably
+		uint64_t iterations = 1;
+		double elapsed = RunSample(func, iterations);
+		while (elapsed < sampleTime * 0.1 && iterations < (1ull << 40)) {
+			iterations *= 10;
+			elapsed = RunSample(func, iterations);
+		}
+		if (elapsed > 0.0)
+			iterations = std::max<uint64_t>(1, static_cast<uint64_t>(static_cast<double>(iterations) * sampleTime / elapsed));
+
+		// Warm up caches, branch predictors and lazily created state
+		double warmup = 0.0;
+		while (warmup < m_Options.WarmupTime)
+			warmup += RunSample(func, iterations);
+
+		std::vector<double> perOp;
+		perOp.reserve(m_Options.Samples);
+		for (uint32_t i = 0; i < std::max(m_Options.Samples, 1u); ++i)
+			perOp.push_back(RunSample(func, iterations) * 1e9 / static_cast<double>(iterations));
+
+		Result result;
+		result.Name = name;
+		result.Iterations = iterations;
+		result.Samples = static_cast<uint32_t>(perOp.size());
+		result.Median = Median(perOp);
+		result.Min = *std::min_element(perOp.begin(), perOp.end());
+		result.Max = *std::max_element(perOp.begin(), perOp.end());
+
+		std::vector<double> deviations;
+		deviations.reserve(perOp.size());
+		for (double value : perOp)
+			deviations.push_back(std::abs(value - result.Median));
+		result.MAD = Median(std::move(deviations));
+
+		return result;
+	}
+
+
+	std::string BenchRunner::ToJson(const std::string& appName) const
+	{
+		std::string json;
+		json += "{\n";
+		json += fmt::format("  \"app\": \"{}\",\n", JsonEscape(appName));
+		json += fmt::format("  \"engine_version\": \"{}.{}.{}\",\n",
+			HE_VERSION_MAJOR(HE_VERSION), HE_VERSION_MINOR(HE_VERSION), HE_VERSION_PATCH(HE_VERSION));
+#ifdef BUILD_DEBUG
+		json += "  \"build\": \"Debug\",\n";
+#else
+		json += "  \"build\": \"Release\",\n";
+#endif
+		json += fmt::format("  \"timestamp\": {},\n", static_cast<long long>(std::time(nullptr)));
+		json += fmt::format("  \"clock\": \"{}\",\n", HE::Clock::GetSourceName());
+		json += fmt::format("  \"hardware_threads\": {},\n", std::thread::hardware_concurrency());
+		json += fmt::format("  \"samples\": {},\n", m_Options.Samples);
+		json += fmt::format("  \"sample_time_s\": {},\n", m_Options.SampleTime);
+		json += "  \"unit\": \"ns/op\",\n";
+		json += "  \"benchmarks\": [";
+
+		for (size_t i = 0; i < m_Results.size(); ++i)
+		{
+			const Result& r = m_Results[i];
+			json += (i == 0) ? "\n" : ",\n";
+			json += fmt::format("    {{ \"name\": \"{}\", \"median\": {:.3f}, \"mad\": {:.3f}, \"min\": {:.3f}, \"max\": {:.3f}, \"iterations\": {}, \"samples\": {}",
+				JsonEscape(r.Name), r.Median, r.MAD, r.Min, r.Max, r.Iterations, r.Samples);
+			if (!r.Params.empty()) {
+				json += ", \"params\": {";
+				for (size_t p = 0; p < r.Params.size(); ++p)
+					json += fmt::format("{}\"{}\": {}", p ? ", " : " ", JsonEscape(r.Params[p].first), r.Params[p].second);
+				json += " }";
+			}
+			json += " }";
+		}
+
+		json += "\n  ],\n";
+		json += "  \"checks\": [";
+		for (size_t i = 0; i < m_CheckResults.size(); ++i)
+		{
+			const CheckResult& c = m_CheckResults[i];
+			json += (i == 0) ? "\n" : ",\n";
+			json += fmt::format("    {{ \"name\": \"{}\", \"passed\": {}", JsonEscape(c.Name), c.Failure.empty() ? "true" : "false");
+			if (!c.Failure.empty())
+				json += fmt::format(", \"failure\": \"{}\"", JsonEscape(c.Failure));
+			json += " }";
+		}
+
+		json += "\n  ]\n}\n";
+		return json;
+	}
+
+
+} // namespace Bench
@@ -0,0 +1,129 @@
+//==============================================================================
+// Benchmark Harness
+//
+// Minimal benchmark runner for the headless Helios-Bench application. A
+// benchmark is a function that runs the measured operation N times; the
+// runner calibrates N so one sample takes about Options::SampleTime, warms up,
+// takes Options::Samples samples and reports the time per operation as median
+// and median absolute deviation (MAD), which stay stable with a few outliers
+// from the scheduler or page faults. Results are written as JSON so runs can
+// be compared over time. Checks are unmeasured correctness runs (stress
+// cases, asserted stats) reported next to the results; a failed check fails
+// the whole run.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Usage:
+//   runner.Add("group.name", [&](uint64_t iterations) {
+//       for (uint64_t i = 0; i < iterations; ++i)
+//           DoNotOptimize(Work());
+//   });
+//   runner.AddCheck("group.name", [&]() -> std::string {
+//       return ok ? "" : "what went wrong";
+//   });
+//
+// Changelog:
+// - 2026.10: Added checks (AddCheck)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#	include <intrin.h>
+#endif
+
+namespace Bench {
+
+
+	// Keeps the compiler from optimizing away a value that is never used
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		static const void* volatile s_Sink;
+		s_Sink = &value;
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r"(&value) : "memory");
+#endif
+	}
+
+
+	class BenchRunner
+	{
+	public:
+		using BenchFunc = std::function<void(uint64_t iterations)>;
+		using CheckFunc = std::function<std::string()>; // empty on success, the failure otherwise
+
+		struct Options
+		{
+			uint32_t Samples = 15;      // measured samples per benchmark
+			double SampleTime = 0.01;   // seconds per sample (iterations are calibrated)
+			double WarmupTime = 0.05;   // seconds of unmeasured runs before sampling
+			std::string Filter;         // only run benchmarks whose name contains this
+		};
+
+		struct Result
+		{
+			std::string Name;
+			uint64_t Iterations = 0;    // per sample
+			uint32_t Samples = 0;
+			double Median = 0.0;        // ns per operation
+			double MAD = 0.0;
+			double Min = 0.0;
+			double Max = 0.0;
+			std::vector<std::pair<std::string, double>> Params; // e.g. workers = 4
+		};
+
+		struct CheckResult
+		{
+			std::string Name;
+			std::string Failure; // empty: passed
+		};
+
+		explicit BenchRunner(const Options& options) : m_Options(options) {}
+
+		// Register a benchmark, params are copied into its result
+		void Add(const std::string& name, BenchFunc func, std::vector<std::pair<std::string, double>> params = {});
+
+		// Setup/teardown around a group of benchmarks (e.g. job system worker count), not measured
+		void AddStep(std::function<void()> step);
+
+		// Correctness check, runs once in registration order (filtered like benchmarks)
+		void AddCheck(const std::string& name, CheckFunc check);
+
+		void Run();
+
+		const std::vector<Result>& GetResults() const { return m_Results; }
+		const std::vector<CheckResult>& GetCheckResults() const { return m_CheckResults; }
+		uint32_t GetFailedCheckCount() const;
+		std::string ToJson(const std::string& appName) const;
+
+	private:
+		Result Measure(const std::string& name, const BenchFunc& func);
+		double RunSample(const BenchFunc& func, uint64_t iterations); // seconds
+
+	private:
+		struct Entry
+		{
+			std::string Name;
+			BenchFunc Func;
+			std::function<void()> Step; // set for AddStep entries
+			CheckFunc Check;            // set for AddCheck entries
+			std::vector<std::pair<std::string, double>> Params;
+		};
+
+		Options m_Options;
+		std::vector<Entry> m_Entries;
+		std::vector<Result> m_Results;
+		std::vector<CheckResult> m_CheckResults;
+	};
+
+
+} // namespace Bench
@@ -0,0 +1,143 @@
+#include "pch.h"
+namespace HE = Helios::Engine;
+
+#include "Bench.h"
+#include "Suites/Suites.h"
+
+#include <charconv>
+#include <fstream>
+
+// Headless benchmark application: no window, no main loop, a headless renderer
+// only with --render. Runs all suites in OnInit and writes the results as JSON.
+//
+// Command line (all optional):
+//   --samples=15        measured samples per benchmark
+//   --time=0.01         seconds per sample
+//   --warmup=0.05       warm-up seconds per benchmark
+//   --filter=vfs.       only benchmarks whose name contains the text
+//   --out=bench.json    result file (relative to the working directory), '-' for stdout
+//   --verbose           keep engine debug/trace logging while measuring
+//   --render            create a headless renderer for the draw.frame benchmarks and the
+//                       memory.* checks (needs a Vulkan device, lavapipe is enough for CI:
+//                       VK_ICD_FILENAMES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json)
+
+
+class App : public HE::Application
+{
+public:
+	App(const HE::AppSpec& spec) : HE::Application(spec) {}
+
+	static constexpr int APP_VERSION_MAJOR = 0;
+	static constexpr int APP_VERSION_MINOR = 1;
+	static constexpr int APP_VERSION_PATCH = 0;
+	static constexpr uint32_t APP_VERSION = HE_MAKE_VERSION(APP_VERSION_MAJOR, APP_VERSION_MINOR, APP_VERSION_PATCH);
+
+	virtual void OnInit() override;
+	virtual void OnShutdown() override;
+};
+
+
+namespace {
+
+	// Numeric option, the default (with a warning) if it is missing, malformed or below 'minimum'
+	template<typename T>
+	T GetNumberArg(const HE::AppSpec::CommandLineArgs& args, std::string_view name, T defaultValue, T minimum)
+	{
+		std::string text = args.Get(name, "");
+		if (text.empty())
+			return defaultValue;
+
+		T value{};
+		const char* end = text.data() + text.size();
+		auto [ptr, ec] = std::from_chars(text.data(), end, value);
+		if (ec != std::errc() || ptr != end || !(value >= minimum)) { // negated: NaN fails as well
+			LOG_WARN("Helios-Bench: Invalid value '{}' for --{}, using {}.", text, name, defaultValue);
+			return defaultValue;
+		}
+		return value;
+	}
+
+} // namespace
+
+
+HE::Application* HE::CreateApplication(int argc, char** argv)
+{
+	// Init App Specification
+	HE::AppSpec appSpec;
+	appSpec.CmdLineArgs = { argc, argv };
+	appSpec.Name = "Helios-Bench";
+	appSpec.Version = App::APP_VERSION;
+	appSpec.Hints |= HE::AppSpec::HintFlags::USE_CWD;
+	appSpec.Hints |= HE::AppSpec::HintFlags::NO_MAINLOOP;
+	appSpec.LogFile = "Helios-Bench.log";
+	appSpec.ConfigUser = "user_bench";
+
+	return new App(appSpec);
+}
+
+
+void App::OnInit()
+{
+	LOG_INFO("Helios-Bench: Init.");
+
+	const auto& args = GetAppSpec().CmdLineArgs;
+	Bench::BenchRunner::Options options;
+	options.Samples    = GetNumberArg<uint32_t>(args, "samples", 15, 1);
+	options.SampleTime = GetNumberArg<double>(args, "time", 0.01, 1e-6);
+	options.WarmupTime = GetNumberArg<double>(args, "warmup", 0.05, 0.0);
+	options.Filter     = args.Get("filter", "");
+	std::string outFile = args.Get("out", "bench.json");
+
+	// Offscreen images instead of a window, see AppSpec::Headless
+	HE::Renderer::Renderer* renderer = nullptr;
+	if (args.Check("render")) {
+		GetAppSpec().Headless.Enabled = true;
+		InitRenderer();
+		renderer = &GetRenderer();
+	}
+
+	const std::string dataPath = (std::filesystem::path(GetAppSpec().WorkingDirectory) / "bench_data").string();
+
+	Bench::BenchRunner runner(options);
+	Bench::RegisterClockSuite(runner);
+	Bench::RegisterEventSuite(runner, *this);
+	Bench::RegisterConfigSuite(runner);
+	Bench::RegisterVFSSuite(runner, dataPath);
+	Bench::RegisterCameraSuite(runner);
+	Bench::RegisterJobSuite(runner, *this);
+	Bench::RegisterDrawSuite(runner, renderer);
+	Bench::RegisterMemorySuite(runner, renderer);
+
+	// Engine debug output (e.g. VFS cache messages) would be measured as well
+	int coreLevel = HE::Log::GetLevel(HE::LogCategory::Core);
+	if (!args.Check("verbose"))
+		HE::Log::SetLevel(HE::LogCategory::Core, std::max(coreLevel, LOG_LEVEL_INFO));
+	runner.Run();
+	HE::Log::SetLevel(HE::LogCategory::Core, coreLevel);
+
+	std::string json = runner.ToJson(GetAppSpec().Name);
+	if (outFile == "-") {
+		std::cout << json;
+	}
+	else {
+		std::ofstream out(outFile, std::ios::out | std::ios::trunc);
+		if (out.is_open()) {
+			out << json;
+			LOG_INFO("Helios-Bench: {} result(s) written to '{}'.", runner.GetResults().size(), outFile);
+		}
+		else {
+			LOG_ERROR("Helios-Bench: Failed to write '{}'.", outFile);
+		}
+	}
+
+	// Non-zero exit code for CI
+	if (uint32_t failed = runner.GetFailedCheckCount()) {
+		LOG_EXCEPT("Helios-Bench: {} of {} check(s) failed.", failed, runner.GetCheckResults().size());
+	}
+}
+
+
+void App::OnShutdown()
+{
+	LOG_INFO("Helios-Bench: Shutdown.");
+}
@@ -0,0 +1,62 @@
+//==============================================================================
+// Benchmark Suites: Camera
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/Renderer/CameraPerspective.h>
+
+#include <glm/glm.hpp>
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+	void RegisterCameraSuite(BenchRunner& runner)
+	{
+		auto camera = std::make_shared<HE::Renderer::PerspectiveCamera>(45.0f, 16.0f / 9.0f, 0.1f, 100.0f);
+
+		// View + view-projection matrix rebuild, once per frame in the main loop
+		runner.Add("camera.set_rotation", [camera](uint64_t iterations) {
+			float angle = 0.0f;
+			for (uint64_t i = 0; i < iterations; ++i) {
+				angle += 0.001f;
+				camera->SetRotation({ 0.0f, angle, 0.0f });
+				DoNotOptimize(camera->GetViewProjectionMatrix());
+			}
+		});
+
+		runner.Add("camera.set_projection", [camera](uint64_t iterations) {
+			float fov = 45.0f;
+			for (uint64_t i = 0; i < iterations; ++i) {
+				fov = (fov > 90.0f) ? 45.0f : fov + 0.01f;
+				camera->SetProjection(fov, 16.0f / 9.0f, 0.1f, 100.0f);
+				DoNotOptimize(camera->GetViewProjectionMatrix());
+			}
+		});
+
+		// Transform a batch of points by the view-projection matrix (per-vertex style CPU work)
+		constexpr uint32_t Points = 1024;
+		auto points = std::make_shared<std::vector<glm::vec4>>(Points);
+		for (uint32_t i = 0; i < Points; ++i)
+			(*points)[i] = glm::vec4(static_cast<float>(i % 32) - 16.0f, static_cast<float>(i / 32) - 16.0f, -10.0f, 1.0f);
+
+		runner.Add(fmt::format("camera.transform/points:{}", Points), [camera, points](uint64_t iterations) {
+			const glm::mat4& vp = camera->GetViewProjectionMatrix();
+			glm::vec4 sum(0.0f);
+			for (uint64_t n = 0; n < iterations; ++n) {
+				for (const glm::vec4& p : *points)
+					sum += vp * p;
+				DoNotOptimize(sum);
+			}
+		}, { { "points", Points } });
+	}
+
+
+} // namespace Bench
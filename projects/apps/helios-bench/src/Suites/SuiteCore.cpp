@@ -0,0 +1,151 @@
+//==============================================================================
+// Benchmark Suites: Clock, Events, Layers, Config
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/Core/Clock.h>
+#include <Helios/Engine/Core/Config.h>
+#include <Helios/Engine/Core/EventTypeKey.h>
+#include <Helios/Engine/Core/EventTypeMouse.h>
+
+#include <chrono>
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+	namespace {
+
+		// Does a little work per callback, like a layer that only forwards to its systems
+		class BenchLayer : public HE::Layer
+		{
+		public:
+			BenchLayer() : HE::Layer("BenchLayer") {}
+
+			void OnUpdate(float timestep) override { m_Time += timestep; ++m_Updates; }
+
+			void OnEvent(HE::Event& event) override
+			{
+				HE::EventDispatcher dispatcher(event);
+				dispatcher.Dispatch<HE::MouseMovedEvent>([this](const HE::MouseMovedEvent&) { ++m_Events; return false; });
+				dispatcher.Dispatch<HE::KeyPressedEvent>([this](const HE::KeyPressedEvent&) { ++m_Events; return false; });
+			}
+
+		private:
+			float m_Time = 0.0f;
+			uint64_t m_Updates = 0;
+			uint64_t m_Events = 0;
+		};
+
+		constexpr uint32_t LayerCount = 16;
+
+	} // anonymous namespace
+
+
+	void RegisterClockSuite(BenchRunner& runner)
+	{
+		runner.Add("clock.now", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(HE::Clock::Now());
+		});
+
+		runner.Add("clock.steady_clock_now", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(std::chrono::steady_clock::now());
+		});
+
+		runner.Add("clock.high_resolution_clock_now", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(std::chrono::high_resolution_clock::now());
+		});
+	}
+
+
+	void RegisterEventSuite(BenchRunner& runner, HE::Application& app)
+	{
+		runner.Add("events.dispatcher", [](uint64_t iterations) {
+			HE::KeyPressedEvent event(65, 30, 0, 0);
+			uint64_t handled = 0;
+			for (uint64_t i = 0; i < iterations; ++i) {
+				event.Handled = false;
+				HE::EventDispatcher dispatcher(event);
+				dispatcher.Dispatch<HE::MouseMovedEvent>([&](const HE::MouseMovedEvent&) { ++handled; return true; });
+				dispatcher.Dispatch<HE::MouseScrolledEvent>([&](const HE::MouseScrolledEvent&) { ++handled; return true; });
+				dispatcher.Dispatch<HE::KeyPressedEvent>([&](const HE::KeyPressedEvent&) { ++handled; return true; });
+			}
+			DoNotOptimize(handled);
+		});
+
+		// The application owns (and deletes) the layers
+		runner.AddStep([&app] {
+			for (uint32_t i = 0; i < LayerCount; ++i)
+				app.PushLayer(new BenchLayer());
+		});
+
+		runner.Add(fmt::format("events.application_dispatch/layers:{}", LayerCount), [&app](uint64_t iterations) {
+			HE::KeyPressedEvent event(65, 30, 0, 0);
+			for (uint64_t i = 0; i < iterations; ++i) {
+				event.Handled = false;
+				app.OnEvent(event);
+			}
+		}, { { "layers", LayerCount } });
+
+		auto stack = std::make_shared<HE::LayerStack>();
+		for (uint32_t i = 0; i < LayerCount; ++i)
+			stack->PushLayer(new BenchLayer());
+
+		runner.Add(fmt::format("layers.update/layers:{}", LayerCount), [stack](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i) {
+				for (HE::Layer* layer : *stack)
+					layer->OnUpdate(0.016f);
+			}
+			DoNotOptimize(*stack);
+		}, { { "layers", LayerCount } });
+	}
+
+
+	void RegisterConfigSuite(BenchRunner& runner)
+	{
+		auto& cfg = HE::ConfigManager::GetInstance();
+
+		runner.AddStep([&cfg] {
+			cfg.Set<int>("bench", "Values", "Int", 42);
+			cfg.Set<std::string>("bench", "Values", "String", "Helios");
+		});
+
+		runner.Add("config.get_int", [&cfg](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(cfg.Get<int>("bench", "Values", "Int", 0));
+		});
+
+		runner.Add("config.get_string", [&cfg](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(cfg.Get<std::string>("bench", "Values", "String", ""));
+		});
+
+		runner.Add("config.get_missing", [&cfg](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(cfg.Get<int>("bench", "Values", "Missing", 7));
+		});
+
+		// Falls through every loaded layer of the engine domain
+		runner.Add("config.get_engine_fallback", [&cfg](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(cfg.Get<float>("engine", "Bench", "Missing", 1.0f));
+		});
+
+		runner.Add("config.set_int", [&cfg](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				cfg.Set<int>("bench", "Values", "Int", static_cast<int>(i));
+		});
+	}
+
+
+} // namespace Bench
@@ -0,0 +1,196 @@
+//==============================================================================
+// Benchmark Suites: Draw Submission
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/Renderer/Renderer.h>
+#include <Helios/Engine/Renderer/RendererAPI.h>
+#include <Helios/Engine/Renderer/DrawList.h>
+
+#ifdef HE_RENDERER_VULKAN
+#	include <Helios/Platform/Renderer/Vulkan/VKRenderer.h>
+#endif
+
+#include <glm/glm.hpp>
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+	namespace {
+
+		constexpr uint32_t DrawMeshes = 64;
+		constexpr uint32_t DrawMaterials = 16;
+		constexpr uint32_t DrawCounts[] = { 1000, 10000, 100000, 500000 };
+
+		// Small instances on a grid, meshes and materials interleaved so the sort has work to do
+		std::vector<HE::Renderer::DrawInstance> MakeScene(uint32_t count, HE::Renderer::MeshHandle firstMesh)
+		{
+			const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+			const float scale = 2.0f / static_cast<float>(side);
+
+			std::vector<HE::Renderer::DrawInstance> scene(count);
+			for (uint32_t i = 0; i < count; ++i) {
+				auto& instance = scene[i];
+				instance.Transform = glm::mat4(1.0f);
+				instance.Transform[0][0] = scale;
+				instance.Transform[1][1] = scale;
+				instance.Transform[3] = glm::vec4(-1.0f + scale * (static_cast<float>(i % side) + 0.5f), -1.0f + scale * (static_cast<float>(i / side) + 0.5f), 0.0f, 1.0f);
+				instance.Color = glm::vec4(static_cast<float>(i % 7) / 7.0f, static_cast<float>(i % 5) / 5.0f, 1.0f, 1.0f);
+				instance.Mesh = firstMesh + (i * 31) % DrawMeshes;
+				instance.Material = (i / 3) % DrawMaterials;
+			}
+			return scene;
+		}
+
+	} // anonymous namespace
+
+
+	void RegisterDrawSuite(BenchRunner& runner, HE::Renderer::Renderer* renderer)
+	{
+		// CPU side of a frame without a GPU: submit into the list, radix sort, build the batches
+		for (uint32_t count : DrawCounts) {
+			auto scene = std::make_shared<std::vector<HE::Renderer::DrawInstance>>(MakeScene(count, 0));
+			auto list = std::make_shared<HE::Renderer::DrawList>();
+			auto sorter = std::make_shared<HE::Renderer::DrawSorter>();
+
+			runner.Add(fmt::format("draw.submit_sort/instances:{}", count), [scene, list, sorter](uint64_t iterations) {
+				for (uint64_t n = 0; n < iterations; ++n) {
+					list->Clear();
+					list->Submit(scene->data(), scene->size());
+					sorter->Sort(*list);
+					DoNotOptimize(sorter->GetBatches().size());
+				}
+			}, { { "instances", count }, { "meshes", DrawMeshes }, { "materials", DrawMaterials } });
+		}
+
+		// Whole headless frames (BeginFrame/DrawFrame/EndFrame, includes the fence wait of the frame in flight)
+		if (!renderer)
+			return;
+
+		// Quads of different sizes, created once (the upload goes out with the first measured frame)
+		HE::Renderer::MeshHandle firstMesh = 0;
+		for (uint32_t m = 0; m < DrawMeshes; ++m) {
+			const float s = 0.3f + 0.2f * static_cast<float>(m) / DrawMeshes;
+			const std::array<HE::Renderer::MeshVertex, 4> vertices = { {
+				{ { -s, -s, 0.0f }, { 1.0f, 0.0f, 0.0f } },
+				{ {  s, -s, 0.0f }, { 0.0f, 1.0f, 0.0f } },
+				{ {  s,  s, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+				{ { -s,  s, 0.0f }, { 1.0f, 1.0f, 1.0f } },
+			} };
+			const std::array<uint32_t, 6> indices = { 0, 1, 2, 2, 3, 0 };
+			HE::Renderer::MeshHandle mesh = renderer->CreateMesh({ vertices, indices });
+			if (m == 0)
+				firstMesh = mesh;
+		}
+
+		// Draw modes measured one after the other (Vulkan: direct draws and multi draw indirect when supported)
+		struct FrameMode {
+			std::string Name;
+			double Indirect = 0.0;
+			std::function<void()> Apply;
+		};
+		std::vector<FrameMode> modes;
+		std::function<void()> restoreMode;
+#	ifdef HE_RENDERER_VULKAN
+		using VKRenderer = HE::Renderer::Vulkan::VKRenderer;
+		VKRenderer* vkRenderer = nullptr;
+		if (HE::Renderer::RendererAPI::GetAPI() == HE::Renderer::RendererAPI::API::Vulkan) {
+			vkRenderer = static_cast<VKRenderer*>(renderer);
+			for (const auto& entry : { std::pair{ VKRenderer::DrawMode::Direct, "direct" }, std::pair{ VKRenderer::DrawMode::Indirect, "indirect" } }) {
+				const VKRenderer::DrawMode mode = entry.first;
+				const char* name = entry.second;
+				if (vkRenderer->IsDrawModeSupported(mode))
+					modes.push_back({ name, mode == VKRenderer::DrawMode::Indirect ? 1.0 : 0.0, [vkRenderer, mode] { vkRenderer->SetDrawMode(mode); } });
+				else
+					LOG_INFO("Helios-Bench: draw.frame/mode:{} skipped (not supported by the device).", name);
+			}
+			restoreMode = [vkRenderer, mode = vkRenderer->GetDrawMode()] { vkRenderer->SetDrawMode(mode); };
+		}
+#	endif
+		if (modes.empty())
+			modes.push_back({ "default", 0.0, nullptr });
+
+		std::vector<std::shared_ptr<HE::Renderer::FramePacket>> packets;
+		for (uint32_t count : DrawCounts) {
+			auto packet = std::make_shared<HE::Renderer::FramePacket>();
+			std::vector<HE::Renderer::DrawInstance> scene = MakeScene(count, firstMesh);
+			packet->Draws.Submit(scene.data(), scene.size());
+			packets.push_back(packet);
+		}
+
+		for (const FrameMode& mode : modes) {
+			if (mode.Apply)
+				runner.AddStep(mode.Apply);
+
+			for (size_t p = 0; p < packets.size(); ++p) {
+				const uint32_t count = DrawCounts[p];
+				const std::string name = fmt::format("draw.frame/mode:{}/instances:{}", mode.Name, count);
+				runner.Add(name, [renderer, packet = packets[p]](uint64_t iterations) {
+					for (uint64_t n = 0; n < iterations; ++n) {
+						packet->FrameIndex++;
+						if (renderer->BeginFrame(*packet)) {
+							renderer->DrawFrame();
+							renderer->EndFrame();
+						}
+					}
+				}, { { "instances", count }, { "meshes", DrawMeshes }, { "materials", DrawMaterials }, { "indirect", mode.Indirect } });
+
+				// Draw commands stay at the number of distinct keys while the instance count grows
+				runner.AddStep([renderer, name] {
+					HE::Renderer::DrawStats stats = renderer->GetDrawStats();
+					LOG_INFO("Helios-Bench: {}: {} instances, {} batches, {} draw call(s), {} secondary command buffer(s).", name, stats.Instances, stats.Batches, stats.DrawCalls, stats.CommandBuffers);
+				});
+			}
+		}
+		if (restoreMode)
+			runner.AddStep(restoreMode);
+
+#	ifdef HE_RENDERER_VULKAN
+		if (!vkRenderer)
+			return;
+
+		// A frame with two chunks worth of distinct keys (one instance each) in the renderer's own
+		// configuration must be recorded into secondaries on the job system
+		const uint32_t slots = vkRenderer->GetRecordSlotCount();
+		const uint32_t commands = 2 * vkRenderer->GetParallelMinDraws();
+		auto checkPacket = std::make_shared<HE::Renderer::FramePacket>();
+		{
+			std::vector<HE::Renderer::DrawInstance> scene = MakeScene(commands, firstMesh);
+			for (uint32_t i = 0; i < commands; ++i) {
+				scene[i].Mesh = firstMesh + i % DrawMeshes;
+				scene[i].Material = i / DrawMeshes;
+			}
+			checkPacket->Draws.Submit(scene.data(), scene.size());
+		}
+
+		runner.AddCheck("draw.parallel_recording", [renderer, checkPacket, slots, commands]() -> std::string {
+			if (slots < 2) {
+				LOG_INFO("Helios-Bench: draw.parallel_recording: single recording slot (no job workers, renderer_vulkan/Draw/RecordThreads), nothing to check.");
+				return {};
+			}
+			checkPacket->FrameIndex++;
+			if (!renderer->BeginFrame(*checkPacket))
+				return "frame skipped";
+			renderer->DrawFrame();
+			renderer->EndFrame();
+
+			HE::Renderer::DrawStats stats = renderer->GetDrawStats();
+			if (stats.Batches != commands)
+				return fmt::format("{} batches (expected {})", stats.Batches, commands);
+			if (stats.CommandBuffers < 2)
+				return fmt::format("{} batches recorded into {} secondary command buffer(s) (expected at least 2)", stats.Batches, stats.CommandBuffers);
+			return {};
+		});
+#	endif
+	}
+
+
+} // namespace Bench
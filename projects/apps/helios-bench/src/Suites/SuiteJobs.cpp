@@ -0,0 +1,117 @@
+//==============================================================================
+// Benchmark Suites: JobSystem
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/Core/Clock.h>
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+	namespace {
+
+		constexpr uint32_t JobItems = 16384;
+		constexpr uint32_t RunAfterRounds = 20000;
+		constexpr double RunAfterTimeout = 5.0;
+
+		// Some ALU work per item so batches are not dominated by scheduling
+		inline uint32_t HashItem(uint32_t value)
+		{
+			for (int i = 0; i < 64; ++i) {
+				value ^= value >> 16;
+				value *= 0x7feb352d;
+				value ^= value >> 15;
+			}
+			return value;
+		}
+
+	} // anonymous namespace
+
+
+	void RegisterJobSuite(BenchRunner& runner, HE::Application& app)
+	{
+		auto results = std::make_shared<std::vector<uint32_t>>(JobItems);
+
+		// Single-threaded reference for the speedup of the runs below
+		runner.Add("jobs.serial_baseline", [results](uint64_t iterations) {
+			for (uint64_t n = 0; n < iterations; ++n) {
+				for (uint32_t i = 0; i < JobItems; ++i)
+					(*results)[i] = HashItem(i);
+				DoNotOptimize(results->data());
+			}
+		}, { { "items", JobItems } });
+
+		// Worker counts 1, 2, 4, ... up to the hardware threads minus the main thread
+		const uint32_t configured = app.GetJobSystem().GetWorkerCount();
+		const uint32_t hw = std::max(std::thread::hardware_concurrency(), 2u);
+		std::vector<uint32_t> counts;
+		for (uint32_t workers = 1; workers < hw - 1; workers *= 2)
+			counts.push_back(workers);
+		counts.push_back(hw - 1);
+
+		for (uint32_t workers : counts)
+		{
+			runner.AddStep([&app, workers] { app.RestartJobSystem(workers); });
+
+			runner.Add(fmt::format("jobs.parallel_for/workers:{}", workers), [&app, results](uint64_t iterations) {
+				HE::JobSystem& jobs = app.GetJobSystem();
+				for (uint64_t n = 0; n < iterations; ++n) {
+					jobs.ParallelFor(JobItems, 0, [&](uint32_t i) { (*results)[i] = HashItem(i); });
+					DoNotOptimize(results->data());
+				}
+			}, { { "workers", workers }, { "items", JobItems } });
+
+			// Scheduling overhead of a single job (submit, execute, wake the waiter)
+			runner.Add(fmt::format("jobs.run_wait/workers:{}", workers), [&app](uint64_t iterations) {
+				HE::JobSystem& jobs = app.GetJobSystem();
+				uint32_t value = 0;
+				for (uint64_t n = 0; n < iterations; ++n) {
+					HE::JobCounter counter;
+					jobs.Run([&value] { ++value; }, &counter);
+					jobs.Wait(counter);
+				}
+				DoNotOptimize(value);
+			}, { { "workers", workers } });
+		}
+
+		runner.AddStep([&app, configured] { app.RestartJobSystem(configured); });
+
+		// The last jobs of a counter finishing at the same time must start the RunAfter job exactly once,
+		// and the follow-up counter must not complete before it ran
+		runner.AddCheck("jobs.run_after_stress", [&app]() -> std::string {
+			HE::JobSystem& jobs = app.GetJobSystem();
+			std::atomic<uint32_t> ran = 0;
+			for (uint32_t round = 0; round < RunAfterRounds; ++round) {
+				HE::JobCounter first;
+				HE::JobCounter second;
+				for (int i = 0; i < 3; ++i)
+					jobs.Run([] { DoNotOptimize(HashItem(1)); }, &first);
+				jobs.RunAfter(first, [&ran] { ran.fetch_add(1, std::memory_order_relaxed); }, &second);
+
+				// Bounded, a lost continuation would make Wait() hang
+				const uint64_t deadline = HE::Clock::Now() + HE::Clock::SecondsToTicks(RunAfterTimeout);
+				while (!second.IsDone() && HE::Clock::Now() < deadline)
+					std::this_thread::yield();
+				if (!second.IsDone())
+					return fmt::format("round {}: follow-up not done after {}s (first={} second={} ran={})",
+						round, RunAfterTimeout, first.GetValue(), second.GetValue(), ran.load());
+
+				jobs.Wait(second);
+				jobs.Wait(first);
+				if (ran.load() != round + 1 || first.GetValue() != 0)
+					return fmt::format("round {}: first={} second={} ran={}", round, first.GetValue(), second.GetValue(), ran.load());
+			}
+			return {};
+		});
+	}
+
+
+} // namespace Bench
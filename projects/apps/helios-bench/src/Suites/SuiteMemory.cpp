@@ -0,0 +1,186 @@
+//==============================================================================
+// Benchmark Suites: Vulkan Device Memory
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/Renderer/Renderer.h>
+#include <Helios/Engine/Renderer/RendererAPI.h>
+
+#ifdef HE_RENDERER_VULKAN
+#	include <Helios/Platform/Renderer/Vulkan/VKRenderer.h>
+#	include <Helios/Platform/Renderer/Vulkan/VKMemoryAllocator.h>
+#endif
+
+namespace HE = Helios::Engine;
+
+namespace Bench {
+
+
+#ifdef HE_RENDERER_VULKAN
+	namespace {
+
+		namespace VK = HE::Renderer::Vulkan;
+
+		// Host visible so the checks run on every device (lavapipe has a single memory type)
+		constexpr VK::VKAllocationInfo CheckAllocation = { VK::MemoryUsage::Upload, false };
+
+		vk::MemoryRequirements MakeRequirements(vk::DeviceSize size)
+		{
+			return vk::MemoryRequirements(size, VK::VKMemoryAllocator::MinAllocationSize, ~0u);
+		}
+
+		// The block checks sub-allocate quarter blocks, which a low dedicated threshold would move out of the blocks
+		std::string CheckQuarterFits(const VK::VKMemoryAllocator& allocator)
+		{
+			const vk::DeviceSize quarter = allocator.GetBlockSize() / 4;
+			if (quarter <= allocator.GetDedicatedThreshold())
+				return {};
+			return fmt::format("dedicated threshold {} below a quarter block ({}), check renderer_vulkan/Memory", allocator.GetDedicatedThreshold(), quarter);
+		}
+
+
+		std::string CompareStats(const char* step, const VK::VKMemoryStats& stats, uint32_t blocks, uint32_t allocations, vk::DeviceSize used, uint32_t dedicated)
+		{
+			if (stats.BlockCount == blocks && stats.AllocationCount == allocations && stats.UsedBytes == used && stats.DedicatedCount == dedicated)
+				return {};
+			return fmt::format("{}: blocks {} (expected {}), allocations {} ({}), used {} ({}), dedicated {} ({})", step,
+				stats.BlockCount, blocks, stats.AllocationCount, allocations, stats.UsedBytes, used, stats.DedicatedCount, dedicated);
+		}
+
+
+		// Buddy split and merge in a fresh block: two minimum-sized neighbours next to a quarter block,
+		// freed again they must merge back into the quarter at offset 0 (the other free quarter is higher)
+		std::string CheckBuddy(const VK::VKDeviceManager& deviceManager)
+		{
+			VK::VKMemoryAllocator allocator(deviceManager);
+			const vk::DeviceSize quarter = allocator.GetBlockSize() / 4;
+			const vk::DeviceSize minSize = VK::VKMemoryAllocator::MinAllocationSize;
+			if (std::string error = CheckQuarterFits(allocator); !error.empty())
+				return error;
+
+			VK::VKAllocation a = allocator.Allocate(MakeRequirements(minSize), CheckAllocation);
+			VK::VKAllocation b = allocator.Allocate(MakeRequirements(minSize), CheckAllocation);
+			VK::VKAllocation c = allocator.Allocate(MakeRequirements(quarter), CheckAllocation);
+			if (a.Block != b.Block || a.Block != c.Block || a.Offset != 0 || b.Offset != minSize || c.Offset != quarter)
+				return fmt::format("split: offsets {}, {}, {} (expected 0, {}, {} in one block)", a.Offset, b.Offset, c.Offset, minSize, quarter);
+			if (std::string error = CompareStats("split", allocator.GetStats(), 1, 3, 2 * minSize + quarter, 0); !error.empty())
+				return error;
+
+			allocator.Free(a);
+			allocator.Free(b);
+			VK::VKAllocation d = allocator.Allocate(MakeRequirements(quarter), CheckAllocation);
+			if (d.Offset != 0)
+				return fmt::format("merge: quarter placed at offset {} (expected 0)", d.Offset);
+
+			allocator.Free(c);
+			allocator.Free(d);
+			// The empty block is kept to avoid allocate/free churn
+			return CompareStats("free", allocator.GetStats(), 1, 0, 0, 0);
+		}
+
+
+		// Forced and size based dedicated allocations bypass the blocks
+		std::string CheckDedicated(const VK::VKDeviceManager& deviceManager)
+		{
+			VK::VKMemoryAllocator allocator(deviceManager);
+
+			VK::VKAllocationInfo forced = CheckAllocation;
+			forced.Dedicated = true;
+			VK::VKAllocation small = allocator.Allocate(MakeRequirements(VK::VKMemoryAllocator::MinAllocationSize), forced);
+			VK::VKAllocation large = allocator.Allocate(MakeRequirements(allocator.GetDedicatedThreshold() + 1), CheckAllocation);
+
+			std::string error;
+			VK::VKMemoryStats stats = allocator.GetStats();
+			if (!small.IsDedicated() || !large.IsDedicated())
+				error = fmt::format("not dedicated (forced {}, above threshold {})", small.IsDedicated(), large.IsDedicated());
+			else if (stats.DedicatedBytes != small.Size + large.Size)
+				error = fmt::format("allocate: dedicated bytes {} (expected {})", stats.DedicatedBytes, small.Size + large.Size);
+			else
+				error = CompareStats("allocate", stats, 0, 2, 0, 2);
+
+			// Dedicated memory is not released by the allocator's destructor, free it on failure too
+			allocator.Free(small);
+			allocator.Free(large);
+			if (!error.empty())
+				return error;
+			return CompareStats("free", allocator.GetStats(), 0, 0, 0, 0);
+		}
+
+
+		// A full block with one hole and a second block with a single quarter: the plan moves that quarter
+		// into the hole. Cancel must leave everything as it was, commit must release the emptied block.
+		std::string CheckDefragmentation(const VK::VKDeviceManager& deviceManager)
+		{
+			VK::VKMemoryAllocator allocator(deviceManager);
+			const vk::DeviceSize quarter = allocator.GetBlockSize() / 4;
+			if (std::string error = CheckQuarterFits(allocator); !error.empty())
+				return error;
+
+			std::vector<VK::VKAllocation> allocations(5);
+			for (auto& allocation : allocations)
+				allocation = allocator.Allocate(MakeRequirements(quarter), CheckAllocation);
+			VK::VKMemoryBlock* full = allocations[0].Block;
+			VK::VKMemoryBlock* sparse = allocations[4].Block;
+			if (full == sparse || allocations[3].Block != full)
+				return "setup: the fifth quarter did not open a second block";
+
+			allocator.Free(allocations[1]);
+			if (std::string error = CompareStats("setup", allocator.GetStats(), 2, 4, 4 * quarter, 0); !error.empty())
+				return error;
+
+			std::vector<VK::VKAllocation*> live = { &allocations[0], &allocations[2], &allocations[3], &allocations[4] };
+			std::vector<VK::VKDefragMove> moves = allocator.PlanDefragmentation(live);
+			if (moves.size() != 1 || moves[0].Allocation != &allocations[4] || moves[0].Destination.Block != full || moves[0].Destination.Offset != quarter)
+				return fmt::format("plan: {} move(s) (expected the second block's quarter into offset {} of the first)", moves.size(), quarter);
+			if (std::string error = CompareStats("plan", allocator.GetStats(), 2, 5, 5 * quarter, 0); !error.empty())
+				return error;
+
+			allocator.CancelDefragmentation(moves);
+			if (!moves.empty() || allocations[4].Block != sparse)
+				return "cancel: moves not cleared or allocation changed";
+			if (std::string error = CompareStats("cancel", allocator.GetStats(), 2, 4, 4 * quarter, 0); !error.empty())
+				return error;
+
+			moves = allocator.PlanDefragmentation(live);
+			if (moves.size() != 1)
+				return fmt::format("replan: {} move(s) (expected 1)", moves.size());
+			allocator.CommitDefragmentation(moves);
+			if (allocations[4].Block != full || allocations[4].Offset != quarter)
+				return fmt::format("commit: allocation at offset {} (expected {} in the first block)", allocations[4].Offset, quarter);
+			if (std::string error = CompareStats("commit", allocator.GetStats(), 1, 4, 4 * quarter, 0); !error.empty())
+				return error;
+
+			for (VK::VKAllocation* allocation : live)
+				allocator.Free(*allocation);
+			return CompareStats("free", allocator.GetStats(), 1, 0, 0, 0);
+		}
+
+	} // anonymous namespace
+#endif
+
+
+	void RegisterMemorySuite(BenchRunner& runner, HE::Renderer::Renderer* renderer)
+	{
+#	ifdef HE_RENDERER_VULKAN
+		if (!renderer || HE::Renderer::RendererAPI::GetAPI() != HE::Renderer::RendererAPI::API::Vulkan)
+			return;
+
+		// Private allocators on the renderer's device: fresh pools, so offsets and stats are exact
+		const VK::VKDeviceManager& deviceManager = static_cast<VK::VKRenderer*>(renderer)->GetDeviceManager();
+		runner.AddCheck("memory.buddy", [&deviceManager] { return CheckBuddy(deviceManager); });
+		runner.AddCheck("memory.dedicated", [&deviceManager] { return CheckDedicated(deviceManager); });
+		runner.AddCheck("memory.defragmentation", [&deviceManager] { return CheckDefragmentation(deviceManager); });
+#	else
+		(void)runner;
+		(void)renderer;
+#	endif
+	}
+
+
+} // namespace Bench
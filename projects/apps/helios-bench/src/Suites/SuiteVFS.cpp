@@ -0,0 +1,125 @@
+//==============================================================================
+// Benchmark Suites: VFS, IniParser
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Suites.h
+//==============================================================================
+#include "pch.h"
+#include "Suites/Suites.h"
+
+#include <Helios/Engine/VFS/VFS.h>
+#include <Helios/Engine/Util/IniParser.h>
+
+namespace Bench {
+
+
+	namespace {
+
+		// INI text with 'sections' sections of 'keys' mixed-type keys (plus comments)
+		std::string GenerateIni(uint32_t sections, uint32_t keys)
+		{
+			std::string text = "; Generated by Helios-Bench\n\n";
+			for (uint32_t s = 0; s < sections; ++s)
+			{
+				text += fmt::format("; Section comment {}\n[Section{}]\n", s, s);
+				for (uint32_t k = 0; k < keys; ++k)
+				{
+					switch (k % 4) {
+						case 0: text += fmt::format("Int{} = {}\n", k, k * 17); break;
+						case 1: text += fmt::format("Float{} = {:.4f}\n", k, k * 0.25); break;
+						case 2: text += fmt::format("Bool{} = {}\n", k, (k & 2) ? "true" : "false"); break;
+						default: text += fmt::format("; Key comment\nString{} = \"value {}\"\n", k, k); break;
+					}
+				}
+				text += "\n";
+			}
+			return text;
+		}
+
+	} // anonymous namespace
+
+
+	void RegisterVFSSuite(BenchRunner& runner, const std::string& dataPath)
+	{
+		runner.AddStep([dataPath] {
+			std::filesystem::create_directories(dataPath);
+			VirtFS.Mount("bench", dataPath, 0, "HeliosBench", false);
+			VirtFS.CreateAlias("@bench:", "bench/data");
+			VirtFS.CreateDirectories("@bench:");
+
+			VirtFS.WriteText("@bench:small.ini", GenerateIni(4, 8));
+			VirtFS.WriteText("@bench:large.ini", GenerateIni(64, 32));
+			VirtFS.WriteBinary("@bench:blob4k.bin", std::vector<uint8_t>(4 * 1024, 0xAB));
+			VirtFS.WriteBinary("@bench:blob1m.bin", std::vector<uint8_t>(1024 * 1024, 0xCD));
+		});
+
+		// Path resolution (alias + mount lookup), served from the lookup cache after the first call
+		runner.Add("vfs.exists", [](uint64_t iterations) {
+			const std::string path = "@bench:small.ini";
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(VirtFS.Exists(path));
+		});
+
+		runner.Add("vfs.exists_missing", [](uint64_t iterations) {
+			const std::string path = "@bench:missing.ini";
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(VirtFS.Exists(path));
+		});
+
+		// Same lookup with an empty lookup cache every time
+		runner.Add("vfs.exists_uncached", [](uint64_t iterations) {
+			const std::string path = "@bench:small.ini";
+			for (uint64_t i = 0; i < iterations; ++i) {
+				VirtFS.ClearCache();
+				DoNotOptimize(VirtFS.Exists(path));
+			}
+		});
+
+		runner.Add("vfs.read_binary/4k", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(VirtFS.ReadBinary("@bench:blob4k.bin"));
+		}, { { "bytes", 4 * 1024 } });
+
+		runner.Add("vfs.read_binary/1m", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(VirtFS.ReadBinary("@bench:blob1m.bin"));
+		}, { { "bytes", 1024 * 1024 } });
+
+		runner.Add("vfs.read_text/small_ini", [](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(VirtFS.ReadText("@bench:small.ini"));
+		});
+
+		// IniParser::Load reads through the VFS, so these include the read above
+		runner.Add("ini.load/small", [](uint64_t iterations) {
+			Helios::Util::IniParser ini;
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(ini.Load("@bench:small.ini"));
+		}, { { "sections", 4 }, { "keys", 8 } });
+
+		runner.Add("ini.load/large", [](uint64_t iterations) {
+			Helios::Util::IniParser ini;
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(ini.Load("@bench:large.ini"));
+		}, { { "sections", 64 }, { "keys", 32 } });
+
+		auto ini = std::make_shared<Helios::Util::IniParser>();
+		runner.AddStep([ini] { ini->Load("@bench:large.ini"); });
+
+		runner.Add("ini.get", [ini](uint64_t iterations) {
+			for (uint64_t i = 0; i < iterations; ++i)
+				DoNotOptimize(ini->Get<int>("Section31", "Int16", 0, true));
+		});
+
+		runner.AddStep([dataPath] {
+			VirtFS.RemoveAlias("@bench:");
+			VirtFS.UnmountAllWithID("HeliosBench");
+			std::error_code ec;
+			std::filesystem::remove_all(dataPath, ec);
+		});
+	}
+
+
+} // namespace Bench
@@ -0,0 +1,53 @@
+//==============================================================================
+// Benchmark Suites
+//
+// Registration functions of the benchmark groups run by Helios-Bench. Each
+// suite adds its benchmarks (and the unmeasured setup/teardown steps they
+// need) to the runner; names are "<group>.<benchmark>[/<param>:<value>]".
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Changelog:
+// - 2026.10: Draw frames measured once per draw mode
+// - 2026.10: Parallel recording check runs in the renderer's own configuration
+// - 2026.10: Added the parallel recording check to the draw suite
+// - 2026.10: Added the device memory allocator checks
+// - 2026.10: Added the RunAfter stress check to the job suite
+// - 2026.10: Added the draw submission suite
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Bench.h"
+
+namespace Bench {
+
+
+	// Clock::Now vs std::chrono clocks (per-call overhead)
+	void RegisterClockSuite(BenchRunner& runner);
+
+	// EventDispatcher and Application::OnEvent through the layer stack, LayerStack iteration
+	void RegisterEventSuite(BenchRunner& runner, Helios::Engine::Application& app);
+
+	// ConfigManager Get/Set
+	void RegisterConfigSuite(BenchRunner& runner);
+
+	// VFS path resolution and reads, IniParser parse (files below 'dataPath')
+	void RegisterVFSSuite(BenchRunner& runner, const std::string& dataPath);
+
+	// JobSystem scaling over worker counts (restarts the application's job system), RunAfter stress check
+	void RegisterJobSuite(BenchRunner& runner, Helios::Engine::Application& app);
+
+	// Camera matrix updates and view-projection transforms
+	void RegisterCameraSuite(BenchRunner& runner);
+
+	// DrawList submit + sort on the CPU, with a (headless) renderer also whole frames per draw mode and instance count
+	void RegisterDrawSuite(BenchRunner& runner, Helios::Engine::Renderer::Renderer* renderer);
+
+	// VKMemoryAllocator checks on the (headless) renderer's device: buddy split/merge, dedicated
+	// allocations, defragmentation plan/cancel/commit with asserted stats (Vulkan only)
+	void RegisterMemorySuite(BenchRunner& runner, Helios::Engine::Renderer::Renderer* renderer);
+
+
+} // namespace Bench
@@ -10,11 +10,20 @@
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Added headless rendering settings
+// - 2026.10: Added NO_MAINLOOP hint for headless tools
+// - 2026.10: Added asynchronous logging settings
+// - 2026.10: Added event-driven idle mode settings
+// - 2026.10: Added frame limiter settings
+// - 2026.10: Added pipelined rendering switch
+// - 2026.10: Added fixed timestep simulation settings
 // - 2026.01: Changed ConfigFile to ConfigUser for per-user config files
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
 
+#include "Helios/Engine/Core/Log.h"
+
 namespace Helios::Engine {
 
 
@@ -50,13 +59,53 @@ namespace Helios::Engine {
 		{
 			USE_CWD     = (1 << 0), // use the current work dir as base path
 			USE_EXEPATH = (1 << 1), // use path of executeable as base path
+			NO_MAINLOOP = (1 << 2), // only OnInit/OnShutdown, no window or main loop (tools, benchmarks)
 		};
 		
 		// Filename of the logfile
 		std::string LogFile = "log.log";
+
+		// Asynchronous logging (opt-in, queue size, overflow policy), also enabled by the command-line switch "log-async"
+		LogAsyncSpec LogAsync;
 		
 		// Subpath part to the writeable configfile
 		std::string ConfigUser = "user_undefined";
+
+		// Fixed timestep simulation (opt-in, overridable via config domain "engine")
+		struct FixedUpdateSpec
+		{
+			bool  Enabled  = false;         // run Layer::OnFixedUpdate from an accumulator
+			float Timestep = 1.0f / 60.0f;  // simulation step in seconds
+			int   MaxSteps = 5;             // max catch-up steps per frame (avoids spiral of death)
+		} FixedUpdate;
+
+		// Submit frame N on a render thread while the main thread updates frame N+1
+		bool PipelinedRendering = false;
+
+		// Event-driven idle mode: block in glfwWaitEventsTimeout while no layer
+		// needs continuous updates (see Layer::NeedsContinuousUpdate)
+		bool  EventDriven = false;
+		float IdleTimeout = 0.5f; // seconds, max time between frames while idle
+
+		// Frame pacing (overridable via config domain "engine")
+		struct FrameLimitSpec
+		{
+			float TargetFPS     = 0.0f;   // 0 = unlimited
+			float BackgroundFPS = 10.0f;  // while unfocused or minimized, 0 = unlimited
+			float SpinWindow    = 0.001f; // seconds before the deadline spent spinning instead of sleeping
+		} FrameLimit;
+
+		// Headless rendering: no window/surface/swapchain, frames go to offscreen images
+		// (overridable via config domain "engine" or the command-line switch "headless")
+		struct HeadlessSpec
+		{
+			bool        Enabled      = false;
+			uint32_t    Width        = 1280;
+			uint32_t    Height       = 720;
+			uint32_t    ImageCount   = 2;  // offscreen images = frames in flight
+			uint32_t    FrameCount   = 0;  // stop the main loop after this many frames, 0 = unlimited
+			std::string ReadbackFile;      // write the last frame as PPM (relative to the working directory)
+		} Headless;
 	};
 
 
@@ -13,6 +13,7 @@
 #include "Helios/Engine/Core/Timestep.h"
 #include "Helios/Engine/Core/Config.h"
 #include "Helios/Engine/VFS/VFS.h"
+#include "Helios/Engine/Util/Hash.h"
 
 #include "Helios/Engine/Renderer/RendererAPI.h"
 #include "Helios/Engine/Renderer/Renderer.h"
@@ -29,6 +30,9 @@
 
 #include <glm/glm.hpp>
 
+#include <cmath>
+#include <fstream>
+
 // Configuration
 #define IMMEDIATE_EVENT_PROCESSING 1
 
@@ -48,7 +52,8 @@ namespace Helios::Engine {
 			try {
 				auto app = Scope<Application>(CreateApplication(argc, argv));
 				app->OnInit();
-				app->Run();
+				if (!(app->GetAppSpec().Hints & AppSpec::HintFlags::NO_MAINLOOP))
+					app->Run();
 				app->OnShutdown();
 				app.reset();
 
@@ -86,8 +91,10 @@ namespace Helios::Engine {
 		}
 		std::filesystem::current_path(m_Spec.WorkingDirectory);
 
-		// Init logging
-		Log::Init(m_Spec.LogFile, m_Spec.WorkingDirectory);
+		// Init logging (before the config, so async mode is only switchable from the spec or the command line)
+		if (m_Spec.CmdLineArgs.Check("log-async"))
+			m_Spec.LogAsync.Enabled = true;
+		Log::Init(m_Spec.LogFile, m_Spec.WorkingDirectory, m_Spec.LogAsync);
 		LOG_CORE_INFO("Logging started.");
 
 		// Log versions
@@ -119,6 +126,9 @@ namespace Helios::Engine {
 			GLM_VERSION_MINOR,
 			GLM_VERSION_PATCH);
 		LOG_CORE_DEBUG("Working path: {}", m_Spec.WorkingDirectory);
+		// Calibrate the tick frequency here, not on the first conversion inside a frame
+		Clock::Calibrate();
+		LOG_CORE_DEBUG("Clock: {} ({:.3f} MHz)", Clock::GetSourceName(), Clock::GetFrequency() / 1e6);
 
 		// Read config
 //		Config::Read(m_Spec.configfile, m_Spec.WorkingDirectory);
@@ -136,8 +146,94 @@ namespace Helios::Engine {
 		VirtFS.CreateAlias("@config_project:",  "config/" + m_Spec.Name);
 		VirtFS.CreateAlias("@config_user:",     "config/" + m_Spec.ConfigUser);
 
+		// User-writable cache for derived data (pipeline cache, compiled shaders), safe to delete
+		VirtFS.Mount("cache", m_Spec.WorkingDirectory + "/cache", 0, "HeliosEngine", false);
+		VirtFS.CreateAlias("@cache:", "cache/" + m_Spec.Name);
+
 		// Init ConfigManager
 //		ConfigManager::GetInstance().LoadDomain("HeliosEngine/Window", "window_app.ini");
+		ConfigManager::GetInstance().LoadDomain("engine");
+
+		// Runtime log levels (engine config section "Log")
+		Log::ApplyConfig();
+
+		// Main loop settings (config overrides AppSpec defaults)
+		{
+			auto& cfg = ConfigManager::GetInstance();
+			auto& fixed = m_Spec.FixedUpdate;
+			fixed.Enabled  = cfg.Get<bool>( "engine", "MainLoop", "FixedUpdate",   fixed.Enabled);
+			fixed.Timestep = cfg.Get<float>("engine", "MainLoop", "FixedTimestep", fixed.Timestep);
+			fixed.MaxSteps = cfg.Get<int>(  "engine", "MainLoop", "FixedMaxSteps", fixed.MaxSteps);
+			m_Spec.PipelinedRendering = cfg.Get<bool>("engine", "MainLoop", "PipelinedRendering", m_Spec.PipelinedRendering);
+			m_Spec.EventDriven = cfg.Get<bool>( "engine", "MainLoop", "EventDriven", m_Spec.EventDriven);
+			m_Spec.IdleTimeout = cfg.Get<float>("engine", "MainLoop", "IdleTimeout", m_Spec.IdleTimeout);
+			m_Spec.IdleTimeout = std::max(m_Spec.IdleTimeout, 0.001f);
+			if (m_Spec.EventDriven)
+				LOG_CORE_DEBUG("Application: Event-driven idle mode enabled ({}s timeout).", m_Spec.IdleTimeout);
+			if (fixed.Timestep <= 0.0f) {
+				LOG_CORE_WARN("Application: Invalid fixed timestep ({}), using 1/60s.", fixed.Timestep);
+				fixed.Timestep = 1.0f / 60.0f;
+			}
+			fixed.MaxSteps = std::max(fixed.MaxSteps, 1);
+			if (fixed.Enabled)
+				LOG_CORE_DEBUG("Application: Fixed update enabled ({}s step, max {} steps/frame).", fixed.Timestep, fixed.MaxSteps);
+		}
+
+		// Frame limiter settings
+		{
+			auto& cfg = ConfigManager::GetInstance();
+			auto& limit = m_Spec.FrameLimit;
+			limit.TargetFPS     = cfg.Get<float>("engine", "FrameLimiter", "TargetFPS",     limit.TargetFPS);
+			limit.BackgroundFPS = cfg.Get<float>("engine", "FrameLimiter", "BackgroundFPS", limit.BackgroundFPS);
+			limit.SpinWindow    = cfg.Get<float>("engine", "FrameLimiter", "SpinWindow",    limit.SpinWindow);
+			m_FrameLimiter.SetTargetFPS(std::max(limit.TargetFPS, 0.0f));
+			m_FrameLimiter.SetBackgroundFPS(std::max(limit.BackgroundFPS, 0.0f));
+			m_FrameLimiter.SetSpinWindow(std::max(limit.SpinWindow, 0.0f));
+			LOG_CORE_DEBUG("Application: Frame limiter: {} FPS (background {} FPS).", limit.TargetFPS, limit.BackgroundFPS);
+		}
+
+		// Headless rendering settings (config or command-line switch "headless")
+		{
+			auto& cfg = ConfigManager::GetInstance();
+			auto& headless = m_Spec.Headless;
+			headless.Enabled      = cfg.Get<bool>("engine", "Headless", "Enabled", headless.Enabled) || m_Spec.CmdLineArgs.Check("headless");
+			headless.Width        = static_cast<uint32_t>(std::max(cfg.Get<int>("engine", "Headless", "Width",      static_cast<int>(headless.Width)), 1));
+			headless.Height       = static_cast<uint32_t>(std::max(cfg.Get<int>("engine", "Headless", "Height",     static_cast<int>(headless.Height)), 1));
+			headless.ImageCount   = static_cast<uint32_t>(std::max(cfg.Get<int>("engine", "Headless", "ImageCount", static_cast<int>(headless.ImageCount)), 1));
+			headless.FrameCount   = static_cast<uint32_t>(std::max(cfg.Get<int>("engine", "Headless", "FrameCount", static_cast<int>(headless.FrameCount)), 0));
+			headless.ReadbackFile = cfg.Get<std::string>("engine", "Headless", "ReadbackFile", headless.ReadbackFile);
+			if (headless.Enabled)
+				LOG_CORE_INFO("Application: Headless rendering {}x{} ({} images, {} frames).", headless.Width, headless.Height,
+					headless.ImageCount, headless.FrameCount ? std::to_string(headless.FrameCount) : "unlimited");
+		}
+
+		// Profiler session (config or command-line switch "profile")
+#ifdef HE_PROFILE_ENABLED
+		if (ConfigManager::GetInstance().Get<bool>("engine", "Profiler", "Enabled", false) || m_Spec.CmdLineArgs.Check("profile")) {
+			std::string file = ConfigManager::GetInstance().Get<std::string>("engine", "Profiler", "File", "profile.json");
+			Profiler::BeginSession((std::filesystem::path(m_Spec.WorkingDirectory) / file).string());
+		}
+#endif
+
+		// Init job system (0 = one worker per hardware thread, minus the main thread)
+		{
+			int workers = ConfigManager::GetInstance().Get<int>("engine", "JobSystem", "WorkerThreads", 0);
+			m_JobSystem = CreateScope<JobSystem>(static_cast<uint32_t>(std::max(workers, 0)));
+		}
+
+		// Frame statistics (sliding window percentiles, optional periodic dump)
+		{
+			auto& cfg = ConfigManager::GetInstance();
+			double window = cfg.Get<double>("engine", "FrameStats", "Window", 10.0);
+			int slots = cfg.Get<int>("engine", "FrameStats", "Slots", 10);
+			m_FrameStats = CreateScope<FrameStats>(window, static_cast<uint32_t>(std::max(slots, 1)));
+
+			double interval = cfg.Get<double>("engine", "FrameStats", "DumpInterval", 0.0);
+			std::string file = cfg.Get<std::string>("engine", "FrameStats", "DumpFile", "");
+			if (!file.empty())
+				file = (std::filesystem::path(m_Spec.WorkingDirectory) / file).string();
+			m_FrameStats->SetDump(interval, file);
+		}
 
 		// Log and "parse" CmdArgs
 		if (m_Spec.CmdLineArgs.Count > 1)
@@ -180,7 +276,8 @@ namespace Helios::Engine {
 
 //		Config::Save();
 
-		// Shutdown Renderer
+		// Shutdown Renderer (render thread first, it still references the renderer)
+		m_RenderThread.reset();
 		if (m_Renderer) {
 			m_Renderer->Shutdown();
 			m_Renderer.reset();
@@ -189,6 +286,14 @@ namespace Helios::Engine {
 		m_Window.reset();
 		
 		// Shutdown application components
+		m_JobSystem.reset();
+		m_FrameStats.reset();
+#ifdef HE_PROFILE_ENABLED
+		Profiler::EndSession();
+#endif
+#ifdef HE_MEMORY_TRACKING
+		MemoryTracker::LogReport();
+#endif
 		Log::Shutdown();
 
 		s_Instance = nullptr;
@@ -197,13 +302,21 @@ namespace Helios::Engine {
 
 	void Application::InitRenderer()
 	{
-		// Main window
-		m_Window = Renderer::Window::Create(m_Spec.Name);
-		m_Window->Show();
+		// Main window (none in headless mode, the renderer draws into offscreen images)
+		if (!m_Spec.Headless.Enabled) {
+			m_Window = Renderer::Window::Create(m_Spec.Name);
+			m_Window->Show();
+		}
 
 		m_Renderer = Renderer::Renderer::Create();
 		if (m_Renderer) {
-			m_Renderer->Init(m_Spec, *m_Window);
+			m_Renderer->Init(m_Spec, m_Window.get());
+
+			if (m_Spec.PipelinedRendering) {
+				LOG_CORE_DEBUG("Application: Pipelined rendering enabled.");
+				m_RenderThread = CreateScope<Renderer::RenderThread>(*m_Renderer);
+				m_RenderThread->Start();
+			}
 		}
 		else {
 			LOG_CORE_FATAL("Failed to create Renderer!");
@@ -214,6 +327,14 @@ namespace Helios::Engine {
 	}
 
 
+	void Application::RestartJobSystem(uint32_t workerCount)
+	{
+		// The old workers are joined first (JobSystem is a single instance)
+		m_JobSystem.reset();
+		m_JobSystem = CreateScope<JobSystem>(workerCount);
+	}
+
+
 	bool Application::NeedRestart(bool setRestart)
 	{
 		if (setRestart)
@@ -226,57 +347,37 @@ namespace Helios::Engine {
 	{
 // Temporary camera for testing
 Scope<Renderer::PerspectiveCamera> m_Camera;
-m_Camera = CreateScope<Renderer::PerspectiveCamera>(45.0f, m_Window->GetAspectRatio(), 0.1f, 100.0f);
+float aspectRatio = m_Window ? m_Window->GetAspectRatio() : static_cast<float>(m_Spec.Headless.Width) / static_cast<float>(m_Spec.Headless.Height);
+m_Camera = CreateScope<Renderer::PerspectiveCamera>(45.0f, aspectRatio, 0.1f, 100.0f);
 m_Camera->SetPosition({ 0.0f, 0.0f, 3.0f });
 // Temporary camera for testing
 
+		HE_PROFILE_THREAD("Main");
+
 		TimerSec RunLoopTimer;
 		while (m_Running)
 		{
-			Timestep timestep = RunLoopTimer.Elapsed();
-			RunLoopTimer.Reset();
-
-#if 1
-			{ // tempoary for debuging
-				static int fps = 0;
-				static float fps_ts = 0;
-				fps++;
-				fps_ts += timestep;
-				if (fps_ts >= 1.0f)
-				{
-					std::ostringstream title;
-					title << "FPS: " << fps << " (" << (fps_ts / fps) << "s)";
-					glfwSetWindowTitle((GLFWwindow*)m_Window->GetNativeWindow(), title.str().c_str());
-					fps = 0;
-					fps_ts = 0;
-				}
-			} // tempoary for debuging
+			HE_PROFILE_SCOPE("Frame");
 
-//			{
-//				static double lastTime, currentTime;
-//				static int numFrames;
-//				static float frameTime;
-//
-//				currentTime = glfwGetTime();
-//				double delta = currentTime - lastTime;
-//
-//				if (delta >= 1)
-//				{
-//					int framerate{ std::max(1, int(numFrames / delta)) };
-//					std::stringstream title;
-//					title << "Running at " << framerate << " fps.";
-//					glfwSetWindowTitle((GLFWwindow*)m_Window->GetNativeWindow(), title.str().c_str());
-//					lastTime = currentTime;
-//					numFrames = -1;
-//					frameTime = float(1000.0 / framerate);
-//				}
-//				++numFrames;
-//			}
-#endif
+			uint64_t frameTicks = RunLoopTimer.ElapsedTicks();
+			Timestep timestep = RunLoopTimer.Lap();
 
-			// Updating
-			for (Layer* layer : m_LayerStack)
-				layer->OnUpdate(timestep);
+			m_FrameLimiter.AddFrameTime(timestep);
+			m_FrameStats->Add(FrameStat::Frame, frameTicks);
+
+			m_RenderAlpha = 1.0f;
+			{
+				FrameStatScope updateStat(FrameStat::Update);
+
+				// Fixed updating (accumulator based, the interpolation factor is read in OnRender)
+				if (m_Spec.FixedUpdate.Enabled)
+					m_RenderAlpha = FixedUpdate(timestep.GetSeconds());
+
+				// Updating
+				HE_PROFILE_SCOPE("Update");
+				for (Layer* layer : m_LayerStack)
+					layer->OnUpdate(timestep);
+			}
 
 // Rotate the camera
 static float rotationY = 0.0f;
@@ -284,14 +385,40 @@ rotationY += glm::radians(180.0f) * timestep;
 m_Camera->SetRotation({ 0.0f, rotationY, 0.0f });
 
 			// Rendering (only if not minimized!)
-			if (!m_Window->glfwIsMinimized())
+			if (!m_Window || !m_Window->glfwIsMinimized())
 			{
+				HE_PROFILE_SCOPE("Render");
+
+				// Out-of-date swapchain (acquire/present), the window may only be queried from this thread
+				if (m_Renderer->IsSwapchainOutOfDate()) {
+					if (m_RenderThread)
+						m_RenderThread->WaitIdle();
+					m_Renderer->RecreateSwapchain();
+				}
+
+				// Capture everything the renderer needs into the frame packet, layers submit their draws
+				Renderer::FramePacket& packet = m_RenderThread ? m_RenderThread->GetWritePacket() : m_FramePacket;
+				packet.Draws.Clear();
 				for (Layer* layer : m_LayerStack)
 					layer->OnRender();
 
-				m_Renderer->BeginFrame(*m_Camera);
-				m_Renderer->DrawFrame();
-				m_Renderer->EndFrame();
+// Temporary: the built-in test triangle while nothing else is drawn
+if (packet.Draws.IsEmpty())
+	packet.Draws.Submit(Renderer::DrawInstance{});
+
+				packet.FrameIndex = m_FrameIndex++;
+				packet.Alpha = m_RenderAlpha;
+				packet.SetCamera(*m_Camera);
+
+				if (m_RenderThread) {
+					// Render thread submits this frame while we continue with the next update
+					m_RenderThread->Submit();
+				}
+				else {
+					m_Renderer->BeginFrame(packet);
+					m_Renderer->DrawFrame();
+					m_Renderer->EndFrame();
+				}
 
 //				// ImGui rendering
 //				{
@@ -304,10 +431,130 @@ m_Camera->SetRotation({ 0.0f, rotationY, 0.0f });
 //				}
 			}
 
-			// Poll events and so on
-			glfwPollEvents();
-			ProcessEvents();
+			// Poll events and so on (idle: block until input, RequestWake() or timeout)
+			bool idle = m_Window && IsIdle();
+			{
+				HE_PROFILE_SCOPE("Events");
+				HE_MEMORY_TAG("Events");
+				if (m_Window) {
+					if (idle)
+						glfwWaitEventsTimeout(m_Spec.IdleTimeout);
+					else
+						glfwPollEvents();
+				}
+				ProcessEvents();
+			}
+
+			// Frame pacing (throttled while in background, a minimized window would spin otherwise)
+			if (!idle) {
+				HE_PROFILE_SCOPE("FrameLimiter");
+				bool background = m_Window && (m_Window->glfwIsMinimized() || !m_Window->IsFocused());
+				m_FrameLimiter.Wait(background);
+			}
+
+			// Headless runs end after a fixed number of frames (if configured)
+			if (m_Spec.Headless.Enabled && m_Spec.Headless.FrameCount && m_FrameIndex >= m_Spec.Headless.FrameCount)
+				m_Running = false;
+
+			// Periodic frame statistics dump (if configured)
+			m_FrameStats->Tick();
+#ifdef HE_MEMORY_TRACKING
+			MemoryTracker::NextFrame();
+#endif
 		}
+
+		// Let the last submitted frame finish before shutdown starts tearing things down
+		if (m_RenderThread)
+			m_RenderThread->WaitIdle();
+
+		if (m_Spec.Headless.Enabled && !m_Spec.Headless.ReadbackFile.empty())
+			WriteReadback(m_Spec.Headless.ReadbackFile);
+	}
+
+
+	void Application::WriteReadback(const std::string& file)
+	{
+		HE_PROFILE_FUNCTION();
+
+		std::vector<uint8_t> pixels;
+		uint32_t width = 0, height = 0;
+		if (!m_Renderer || !m_Renderer->ReadbackFrame(pixels, width, height)) {
+			LOG_CORE_WARN("Application: No frame available for readback.");
+			return;
+		}
+
+		// Binary PPM (RGB), trivial to diff or convert in CI
+		std::filesystem::path path = std::filesystem::path(m_Spec.WorkingDirectory) / file;
+		std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!out.is_open()) {
+			LOG_CORE_ERROR("Application: Failed to write readback '{}'.", path.string());
+			return;
+		}
+
+		out << "P6\n" << width << " " << height << "\n255\n";
+		uint64_t hash = Util::FNV1A_OFFSET_BASIS; // FNV-1a of the RGB data, for quick comparisons in logs
+		for (size_t i = 0; i + 4 <= pixels.size(); i += 4) {
+			out.write(reinterpret_cast<const char*>(&pixels[i]), 3);
+			hash = Util::HashFnv1a(&pixels[i], 3, hash);
+		}
+
+		LOG_CORE_INFO("Application: Frame {} ({}x{}) written to '{}' (hash {:016x}).", m_FrameIndex, width, height, path.string(), hash);
+	}
+
+
+	float Application::FixedUpdate(double timestep)
+	{
+		HE_PROFILE_FUNCTION();
+
+		const auto& fixed = m_Spec.FixedUpdate;
+		const double step = fixed.Timestep;
+
+		m_FixedAccumulator += timestep;
+
+		int steps = 0;
+		while (m_FixedAccumulator >= step && steps < fixed.MaxSteps)
+		{
+			for (Layer* layer : m_LayerStack)
+				layer->OnFixedUpdate(fixed.Timestep);
+			m_FixedAccumulator -= step;
+			++steps;
+		}
+
+		// Too far behind (e.g. breakpoint, window drag, long load): drop the backlog
+		// instead of trying to catch up, which would only make the next frame slower.
+		if (m_FixedAccumulator >= step) {
+			double dropped = m_FixedAccumulator - std::fmod(m_FixedAccumulator, step);
+			m_FixedAccumulator -= dropped;
+			LOG_CORE_TRACE("Application: Fixed update fell behind, dropped {:.3f}s.", dropped);
+		}
+
+		return static_cast<float>(m_FixedAccumulator / step);
+	}
+
+
+	void Application::RequestWake()
+	{
+		m_WakeRequested.store(true, std::memory_order_release);
+		// Wakes a glfwWaitEvents* call on the main thread, callable from any thread
+		if (!m_Spec.Headless.Enabled)
+			glfwPostEmptyEvent();
+	}
+
+
+	bool Application::IsIdle()
+	{
+		if (!m_Spec.EventDriven)
+			return false;
+
+		// A pending wake request always gets its frame
+		if (m_WakeRequested.exchange(false, std::memory_order_acq_rel))
+			return false;
+
+		for (Layer* layer : m_LayerStack) {
+			if (layer->NeedsContinuousUpdate())
+				return false;
+		}
+		return true;
 	}
 
 
@@ -329,7 +576,7 @@ m_Camera->SetRotation({ 0.0f, rotationY, 0.0f });
 	void Application::ProcessEvents()
 	{
 #		if (IMMEDIATE_EVENT_PROCESSING == 0)
-			std::vector<std::unique_ptr<Event>> events;
+			std::vector<Scope<Event>> events;
 			{
 				std::lock_guard<std::mutex> lock(m_EventQueueMutex);
 				events.swap(m_EventQueue);
@@ -399,9 +646,13 @@ m_Camera->SetRotation({ 0.0f, rotationY, 0.0f });
 		EventDispatcher dispatcher(e);
 		dispatcher.Dispatch<WindowCloseEvent>(HE_BIND_EVENT_FN(Application::OnWindowClose));
 
-		// Forward event to renderer
-		if (m_Renderer)
+		// Forward event to renderer (window events may recreate the swapchain,
+		// so the render thread has to be idle first)
+		if (m_Renderer) {
+			if (m_RenderThread && e.IsInCategory(EventCategory::Window))
+				m_RenderThread->WaitIdle();
 			m_Renderer->OnEvent(e);
+		}
 
 		// Dispatch events to layers in reverse order
 		for (auto it = m_LayerStack.rbegin(); it != m_LayerStack.rend(); ++it) 
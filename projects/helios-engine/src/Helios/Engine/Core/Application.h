@@ -18,9 +18,36 @@
 // - Renderer initialization coordination
 // - Application restart support
 // - Configuration management via AppSpec
+// - Optional fixed timestep simulation with render interpolation
+// - Optional pipelined rendering (render thread + double-buffered FramePacket)
+// - Engine-wide job system (work-stealing worker threads)
+// - Frame limiter with background throttling
+// - Optional event-driven idle mode (wakes on input, RequestWake() or timeout)
+// - Profiler session control and main loop instrumentation
+// - Frame statistics (percentile frame times, periodic dump)
+// - Memory tracking per frame and report at shutdown (HE_MEMORY_TRACKING)
 // - Entry point integration (AppMain) and factory pattern
+// - Headless mode without window and main loop (AppSpec::NO_MAINLOOP)
+// - Headless rendering into offscreen images with optional readback (AppSpec::Headless)
+// - Draw submission from layers into the frame packet (GetDrawList)
 // 
 // Changelog:
+// - 2026.10: Added GetRenderAlpha (fixed timestep interpolation factor for Layer::OnRender)
+// - 2026.10: Removed the FrameAllocator (no transient per-frame user)
+// - 2026.10: Recreates an out-of-date swapchain on the main thread before rendering
+// - 2026.10: Added GetDrawList and GetRenderer, the draw list is cleared before OnRender
+// - 2026.10: Mounts the user-writable @cache: VFS location
+// - 2026.10: Added headless rendering (no window, fixed frame count, readback)
+// - 2026.10: Added NO_MAINLOOP support (headless tools) and RestartJobSystem
+// - 2026.10: Added FrameAllocator ownership, queued event dispatch uses frame memory
+// - 2026.10: Added memory tracking frame boundary, event allocations tagged
+// - 2026.10: Added FrameStats ownership and main loop timings
+// - 2026.10: Added profiler session and markers
+// - 2026.10: Added event-driven idle mode
+// - 2026.10: Added frame limiter, removed FPS window title debug code
+// - 2026.10: Added JobSystem ownership
+// - 2026.10: Added pipelined rendering mode via RenderThread
+// - 2026.10: Added opt-in fixed timestep update (OnFixedUpdate + interpolation)
 // - 2026.01: Added renderer event forwarding
 // - 2026.01: Fixed window name/title
 // - 2026.01: Added hirarchical config support
@@ -34,9 +61,13 @@
 #include "Helios/Engine/Core/LayerStack.h"
 #include "Helios/Engine/Core/Events.h"
 #include "Helios/Engine/Core/EventTypeWindow.h"
+#include "Helios/Engine/Core/JobSystem.h"
+#include "Helios/Engine/Core/FrameLimiter.h"
+#include "Helios/Engine/Core/FrameStats.h"
 
 #include "Helios/Engine/Renderer/Window.h"
 #include "Helios/Engine/Renderer/Renderer.h"
+#include "Helios/Engine/Renderer/RenderThread.h"
 //#include "Helios/Engine/Renderer/DeviceManager.h"
 
 namespace Helios::Engine {
@@ -55,6 +86,16 @@ namespace Helios::Engine {
 		static Application& Get() { return *s_Instance; }
 		AppSpec& GetAppSpec() { return m_Spec; }
 		bool NeedRestart(bool setRestart = false);
+		JobSystem& GetJobSystem() { return *m_JobSystem; }
+		// Recreate the job system with another worker count (0 = hardware default), no jobs may be in flight
+		void RestartJobSystem(uint32_t workerCount);
+		const FrameLimiter& GetFrameLimiter() const { return m_FrameLimiter; }
+		FrameStats& GetFrameStats() { return *m_FrameStats; }
+
+		// Thread-safe: request at least one more frame (wakes the main loop in idle mode)
+		void RequestWake();
+		// Leave the main loop after the current frame
+		void Close() { m_Running = false; }
 
 		void PushLayer(Layer* layer) { m_LayerStack.PushLayer(layer); }
 		void PopLayer(Layer* layer) { m_LayerStack.PopLayer(layer); }
@@ -69,23 +110,40 @@ namespace Helios::Engine {
 		virtual void OnShutdown() {}
 
 		void InitRenderer();
+		Renderer::Renderer& GetRenderer() { return *m_Renderer; }
+		// Blend factor between the previous and current fixed step, [0,1) (1.0 if fixed mode is off), valid in Layer::OnRender
+		float GetRenderAlpha() const { return m_RenderAlpha; }
+		// Draw list of the frame being built, valid in Layer::OnRender
+		Renderer::DrawList& GetDrawList() { return (m_RenderThread ? m_RenderThread->GetWritePacket() : m_FramePacket).Draws; }
 //		Ref<Renderer::Window>& GetAppWindow() { return m_Window; }
 //		Ref<Renderer::DeviceManager>& GetDeviceManager() { return m_DeviceManager; }
 
 	private:
 		void Run();
+		float FixedUpdate(double timestep);
+		bool IsIdle();
+		void WriteReadback(const std::string& file);
 
 	private:
 		AppSpec m_Spec;
 		bool m_Running = true;
 		bool m_Minimized = false;
 		LayerStack m_LayerStack;
+		double m_FixedAccumulator = 0.0;
+		float m_RenderAlpha = 1.0f;
+		Scope<JobSystem> m_JobSystem;
+		FrameLimiter m_FrameLimiter;
+		Scope<FrameStats> m_FrameStats;
+		std::atomic<bool> m_WakeRequested = false;
 
 		std::mutex m_EventQueueMutex;
 		std::vector<Scope<Event>> m_EventQueue;
 
 		Ref<Renderer::Window> m_Window;
 		Scope<Renderer::Renderer> m_Renderer;
+		Scope<Renderer::RenderThread> m_RenderThread; // only in pipelined mode
+		Renderer::FramePacket m_FramePacket;          // used when not pipelined
+		uint64_t m_FrameIndex = 0;
 //		Ref<Renderer::DeviceManager> m_DeviceManager;
 
 	private:
@@ -0,0 +1,115 @@
+//==============================================================================
+// High-Resolution Clock (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Clock.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/Clock.h"
+
+#if defined(HE_CLOCK_TSC) && !defined(_MSC_VER)
+#	include <cpuid.h>
+#endif
+
+#include <thread>
+
+namespace Helios::Engine {
+
+
+	namespace {
+
+#	if defined(HE_CLOCK_TSC)
+		// CPUID 0x80000007 EDX bit 8: TSC runs at a constant rate in all ACPI P-, C- and T-states
+		bool HasInvariantTSC()
+		{
+#		if defined(_MSC_VER)
+			int regs[4] = {};
+			__cpuid(regs, 0x80000000);
+			if (static_cast<unsigned int>(regs[0]) < 0x80000007)
+				return false;
+			__cpuid(regs, 0x80000007);
+			return (regs[3] & (1 << 8)) != 0;
+#		else
+			unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+			if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007)
+				return false;
+			__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+			return (edx & (1u << 8)) != 0;
+#		endif
+		}
+
+
+		// Measure TSC ticks against steady_clock over a short interval
+		uint64_t CalibrateTSC()
+		{
+			using namespace std::chrono;
+
+			auto t0 = steady_clock::now();
+			uint64_t c0 = __rdtsc();
+			std::this_thread::sleep_for(milliseconds(10));
+			auto t1 = steady_clock::now();
+			uint64_t c1 = __rdtsc();
+
+			double seconds = duration<double>(t1 - t0).count();
+			return static_cast<uint64_t>(static_cast<double>(c1 - c0) / seconds);
+		}
+#	elif defined(HE_CLOCK_CNTVCT)
+		// The generic timer reports its own fixed frequency, no measurement needed
+		uint64_t ReadCounterFrequency()
+		{
+			uint64_t frequency;
+			asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+			return frequency;
+		}
+#	endif
+
+	} // namespace
+
+
+	bool Clock::DetectCounter()
+	{
+#	if defined(HE_CLOCK_TSC)
+		return HasInvariantTSC();
+#	elif defined(HE_CLOCK_CNTVCT)
+		return ReadCounterFrequency() > 0;
+#	else
+		return false;
+#	endif
+	}
+
+
+	const Clock::Calibration& Clock::GetCalibration()
+	{
+		static const Calibration calibration = [] {
+			Calibration result;
+			if (UsesCounter()) {
+#			if defined(HE_CLOCK_TSC)
+				// A failed measurement must not leave the counter without a usable rate
+				result.Frequency = std::max<uint64_t>(CalibrateTSC(), 1);
+#			elif defined(HE_CLOCK_CNTVCT)
+				result.Frequency = ReadCounterFrequency();
+#			endif
+			}
+			result.SecondsPerTick = 1.0 / static_cast<double>(result.Frequency);
+			return result;
+		}();
+		return calibration;
+	}
+
+
+	const char* Clock::GetSourceName()
+	{
+#	if defined(HE_CLOCK_TSC)
+		if (UsesCounter())
+			return "TSC";
+#	elif defined(HE_CLOCK_CNTVCT)
+		if (UsesCounter())
+			return "CNTVCT";
+#	endif
+		return "steady_clock";
+	}
+
+
+} // namespace Helios::Engine
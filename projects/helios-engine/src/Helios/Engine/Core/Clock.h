@@ -0,0 +1,99 @@
+//==============================================================================
+// High-Resolution Clock
+//
+// Provides a low-overhead monotonic tick source for timers and the profiler.
+// Uses the invariant time stamp counter on x86-64 (rdtsc) and the virtual
+// counter on ARM64 (CNTVCT_EL0), both readable from user space without a
+// system call. Falls back to std::chrono::steady_clock (ticks = nanoseconds)
+// if no constant-rate counter is available. Time is kept as integer ticks and
+// only converted to seconds at the edges.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Invariant TSC (x86-64) / CNTVCT (ARM64) with steady_clock fallback
+// - TSC frequency calibrated lazily against steady_clock on first use
+// - Integer ticks, double conversion helpers
+//
+// Notes:
+// - The tick source is picked on the first Now() (a CPUID check, no wait) and
+//   never changes afterwards, so ticks taken at any point can be compared.
+// - Calibration waits ~10 ms. It runs on the first conversion or frequency
+//   query; Application calls Calibrate() at startup so it never lands inside
+//   a frame. Nothing runs during static initialization.
+//
+// Changelog:
+// - 2026.10: Lazy calibration instead of a static initializer, fixed tick unit
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#	include <intrin.h>
+#	define HE_CLOCK_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#	include <x86intrin.h>
+#	define HE_CLOCK_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#	define HE_CLOCK_CNTVCT
+#endif
+
+namespace Helios::Engine {
+
+
+	class Clock
+	{
+	public:
+		// Current time in ticks (see GetFrequency)
+		static uint64_t Now()
+		{
+#		if defined(HE_CLOCK_TSC)
+			if (UsesCounter())
+				return __rdtsc();
+#		elif defined(HE_CLOCK_CNTVCT)
+			if (UsesCounter()) {
+				uint64_t value;
+				asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+				return value;
+			}
+#		endif
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+		}
+
+		// Measures the frequency now instead of on the first conversion (idempotent)
+		static void Calibrate() { GetCalibration(); }
+
+		// Ticks per second
+		static uint64_t GetFrequency() { return GetCalibration().Frequency; }
+		// Name of the active tick source ("TSC", "CNTVCT" or "steady_clock")
+		static const char* GetSourceName();
+
+		static double TicksToSeconds(uint64_t ticks) { return static_cast<double>(ticks) * GetCalibration().SecondsPerTick; }
+		static double TicksToMilliseconds(uint64_t ticks) { return TicksToSeconds(ticks) * 1e3; }
+		static double TicksToMicroseconds(uint64_t ticks) { return TicksToSeconds(ticks) * 1e6; }
+		static uint64_t SecondsToTicks(double seconds) { return static_cast<uint64_t>(seconds * static_cast<double>(GetFrequency())); }
+
+	private:
+		struct Calibration
+		{
+			uint64_t Frequency = 1'000'000'000;
+			double SecondsPerTick = 1e-9;
+		};
+
+		// Decided once on first use, thread-safe through the function-local statics
+		static bool UsesCounter()
+		{
+			static const bool useCounter = DetectCounter();
+			return useCounter;
+		}
+		static const Calibration& GetCalibration();
+		static bool DetectCounter();
+	};
+
+
+} // namespace Helios::Engine
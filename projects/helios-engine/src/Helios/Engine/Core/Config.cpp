@@ -419,6 +419,9 @@ namespace Helios::Engine {
 
 	bool ConfigManager::LoadDomain(const std::string& domain)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Config");
+
 		std::unique_lock lock(m_mutex);
 
 		auto& layers = m_domainLayers[domain];
@@ -483,6 +486,9 @@ namespace Helios::Engine {
 
 	bool ConfigManager::SaveDomain(const std::string& domain) const
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Config");
+
 		std::shared_lock lock(m_mutex);
 
 		auto it = m_domainLayers.find(domain);
@@ -621,6 +627,7 @@ namespace Helios::Engine {
 	template<typename T>
 	void ConfigManager::Set(const std::string& domain, const std::string& section, const std::string& key, const T& value)
 	{
+		HE_MEMORY_TAG("Config");
 		std::unique_lock lock(m_mutex);
 
 		ConfigLayer* layer = GetWritableLayer(domain);
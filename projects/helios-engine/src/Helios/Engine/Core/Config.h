@@ -21,6 +21,7 @@
 // - Singleton pattern with auto-creation
 // 
 // Changelog:
+// - 2026.10: Allocations accounted to memory tag "Config"
 // - 2026.01: Added hierarchical priority-based configuration layers
 // - 2026.01: Initial version / start of version history
 //==============================================================================
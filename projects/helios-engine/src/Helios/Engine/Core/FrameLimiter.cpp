@@ -0,0 +1,59 @@
+//==============================================================================
+// Frame Limiter (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file FrameLimiter.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/FrameLimiter.h"
+
+#include <thread>
+
+namespace Helios::Engine {
+
+
+	void FrameLimiter::Wait(bool background)
+	{
+		float fps = background ? m_BackgroundFPS : m_TargetFPS;
+		// A foreground limit below the background limit also applies in background
+		if (background && m_TargetFPS > 0.0f && (fps <= 0.0f || m_TargetFPS < fps))
+			fps = m_TargetFPS;
+
+		SteadyClock::time_point now = SteadyClock::now();
+		if (fps <= 0.0f) {
+			m_NextDeadline = now;
+			return;
+		}
+
+		const auto period = std::chrono::duration_cast<SteadyClock::duration>(std::chrono::duration<double>(1.0 / fps));
+		m_NextDeadline += period;
+
+		// Fell behind by more than a frame (hitch, rate change): resync instead of bursting
+		if (m_NextDeadline < now - period || m_NextDeadline > now + period)
+			m_NextDeadline = now + period;
+
+		// Sleep phase (coarse), the OS may oversleep by up to a scheduler tick
+		const auto spin = std::chrono::duration_cast<SteadyClock::duration>(std::chrono::duration<double>(m_SpinWindow));
+		if (m_NextDeadline - now > spin)
+			std::this_thread::sleep_for(m_NextDeadline - now - spin);
+
+		// Spin phase (accurate)
+		while (SteadyClock::now() < m_NextDeadline)
+			std::this_thread::yield();
+	}
+
+
+	void FrameLimiter::AddFrameTime(float seconds)
+	{
+		// Exponential moving average, roughly the last 20 frames
+		constexpr float smoothing = 0.05f;
+		if (m_SmoothedFrameTime <= 0.0f)
+			m_SmoothedFrameTime = seconds;
+		else
+			m_SmoothedFrameTime += (seconds - m_SmoothedFrameTime) * smoothing;
+	}
+
+
+} // namespace Helios::Engine
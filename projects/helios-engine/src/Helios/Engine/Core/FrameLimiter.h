@@ -0,0 +1,65 @@
+//==============================================================================
+// Frame Limiter
+//
+// Paces the main loop to a target frame rate. Waiting is done in two phases:
+// the thread sleeps until shortly before the deadline (cheap, but the OS
+// scheduler may oversleep) and spins for the remainder (accurate). Deadlines
+// advance by whole frame periods, so small oversleeps do not accumulate into
+// drift. Also keeps an exponentially smoothed frame time for display and
+// diagnostics.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Target FPS (0 = unlimited) with separate background FPS (unfocused/minimized)
+// - Hybrid sleep-then-spin wait with configurable spin window
+// - Drift-free deadline scheduling
+// - Smoothed frame time / FPS estimate
+//
+// Changelog:
+// - 2026.10: Renamed the nested Clock alias to SteadyClock (shadowed Helios::Engine::Clock)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <chrono>
+
+namespace Helios::Engine {
+
+
+	class FrameLimiter
+	{
+	public:
+		using SteadyClock = std::chrono::steady_clock; // not Helios::Engine::Clock, the deadline arithmetic uses chrono durations
+
+		FrameLimiter() = default;
+
+		// 0 = unlimited
+		void SetTargetFPS(float fps) { m_TargetFPS = fps; }
+		void SetBackgroundFPS(float fps) { m_BackgroundFPS = fps; }
+		// Time before the deadline that is spent spinning instead of sleeping
+		void SetSpinWindow(float seconds) { m_SpinWindow = seconds; }
+
+		float GetTargetFPS() const { return m_TargetFPS; }
+		float GetBackgroundFPS() const { return m_BackgroundFPS; }
+
+		// Block until the next frame is due (background: use the background rate)
+		void Wait(bool background);
+
+		// Feed the measured frame time (seconds) into the smoothed estimate
+		void AddFrameTime(float seconds);
+		float GetSmoothedFrameTime() const { return m_SmoothedFrameTime; }
+		float GetSmoothedFPS() const { return m_SmoothedFrameTime > 0.0f ? 1.0f / m_SmoothedFrameTime : 0.0f; }
+
+	private:
+		float m_TargetFPS = 0.0f;
+		float m_BackgroundFPS = 10.0f;
+		float m_SpinWindow = 0.001f;
+
+		SteadyClock::time_point m_NextDeadline{};
+		float m_SmoothedFrameTime = 0.0f;
+	};
+
+
+} // namespace Helios::Engine
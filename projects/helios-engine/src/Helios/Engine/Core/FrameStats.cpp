@@ -0,0 +1,261 @@
+//==============================================================================
+// Frame Statistics (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file FrameStats.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/FrameStats.h"
+
+#include <bit>
+
+namespace Helios::Engine {
+
+
+	//------------------------------------------------------------------------------
+	// FrameHistogram
+	//------------------------------------------------------------------------------
+
+
+	uint32_t FrameHistogram::GetIndex(uint64_t micros)
+	{
+		if (micros < SubBucketCount)
+			return static_cast<uint32_t>(micros);
+
+		micros = std::min(micros, MaxValue);
+
+		// Keep the top SubBucketBits bits, the shift selects the bucket
+		uint32_t shift = static_cast<uint32_t>(std::bit_width(micros)) - SubBucketBits;
+		return shift * SubBucketHalf + static_cast<uint32_t>(micros >> shift);
+	}
+
+
+	uint64_t FrameHistogram::GetHighestEquivalent(uint32_t index)
+	{
+		if (index < SubBucketCount)
+			return index;
+
+		uint32_t shift = index / SubBucketHalf - 1;
+		uint64_t subBucket = index % SubBucketHalf + SubBucketHalf;
+		return ((subBucket + 1) << shift) - 1;
+	}
+
+
+	void FrameHistogram::Record(uint64_t micros)
+	{
+		++m_Buckets[GetIndex(micros)];
+		++m_Count;
+		m_Sum += micros;
+		m_Max = std::max(m_Max, micros);
+	}
+
+
+	void FrameHistogram::Merge(const FrameHistogram& other)
+	{
+		if (other.m_Count == 0)
+			return;
+
+		for (uint32_t i = 0; i < BucketCount; ++i)
+			m_Buckets[i] += other.m_Buckets[i];
+		m_Count += other.m_Count;
+		m_Sum += other.m_Sum;
+		m_Max = std::max(m_Max, other.m_Max);
+	}
+
+
+	void FrameHistogram::Clear()
+	{
+		m_Buckets.fill(0);
+		m_Count = 0;
+		m_Sum = 0;
+		m_Max = 0;
+	}
+
+
+	uint64_t FrameHistogram::GetPercentile(double percentile) const
+	{
+		if (m_Count == 0)
+			return 0;
+
+		percentile = std::clamp(percentile, 0.0, 100.0);
+		uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_Count)));
+		target = std::max<uint64_t>(target, 1);
+
+		uint64_t total = 0;
+		for (uint32_t i = 0; i < BucketCount; ++i)
+		{
+			total += m_Buckets[i];
+			if (total >= target)
+				return std::min(GetHighestEquivalent(i), m_Max);
+		}
+		return m_Max;
+	}
+
+
+	//------------------------------------------------------------------------------
+	// FrameStats
+	//------------------------------------------------------------------------------
+
+
+	FrameStats::FrameStats(double window, uint32_t slots)
+	{
+		if (s_Instance)
+			LOG_CORE_EXCEPT("FrameStats already exists!");
+		s_Instance = this;
+
+		m_SlotCount = std::max(slots, 1u);
+		m_SlotSeconds = std::max(window, 0.1) / m_SlotCount;
+		m_SlotTicks = std::max<uint64_t>(Clock::SecondsToTicks(m_SlotSeconds), 1);
+
+		for (auto& timing : m_Timings)
+			timing.Slots.resize(m_SlotCount);
+
+		m_StartTicks = Clock::Now();
+		m_CurrentSlot = m_StartTicks / m_SlotTicks;
+
+		LOG_CORE_DEBUG("FrameStats: {:.1f}s sliding window ({} slots).", GetWindow(), m_SlotCount);
+	}
+
+
+	FrameStats::~FrameStats()
+	{
+		s_Instance = nullptr;
+	}
+
+
+	void FrameStats::Add(FrameStat stat, uint64_t ticks)
+	{
+		uint64_t micros = static_cast<uint64_t>(Clock::TicksToMicroseconds(ticks) + 0.5);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		Advance(Clock::Now());
+		m_Timings[static_cast<size_t>(stat)].Slots[m_CurrentSlot % m_SlotCount].Record(micros);
+	}
+
+
+	FrameStats::Summary FrameStats::GetSummary(FrameStat stat, double seconds)
+	{
+		// The current slot is only partially filled, one extra slot makes sure the span is covered
+		uint32_t slots = m_SlotCount;
+		if (seconds > 0.0)
+			slots = std::clamp(static_cast<uint32_t>(std::ceil(seconds / m_SlotSeconds)) + 1, 1u, m_SlotCount);
+
+		FrameHistogram merged;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			Advance(Clock::Now());
+
+			const auto& timing = m_Timings[static_cast<size_t>(stat)];
+			for (uint32_t i = 0; i < slots; ++i)
+				merged.Merge(timing.Slots[(m_CurrentSlot - i) % m_SlotCount]);
+		}
+
+		Summary summary;
+		summary.Count = merged.GetCount();
+		summary.P50  = merged.GetPercentile(50.0) * 1e-3;
+		summary.P95  = merged.GetPercentile(95.0) * 1e-3;
+		summary.P99  = merged.GetPercentile(99.0) * 1e-3;
+		summary.Max  = merged.GetMax() * 1e-3;
+		summary.Mean = merged.GetMean() * 1e-3;
+		return summary;
+	}
+
+
+	void FrameStats::Advance(uint64_t now)
+	{
+		// Slots that were not written since their last use are stale, clear them before reuse
+		uint64_t slot = now / m_SlotTicks;
+		if (slot <= m_CurrentSlot)
+			return;
+
+		uint64_t stale = std::min<uint64_t>(slot - m_CurrentSlot, m_SlotCount);
+		for (uint64_t i = 1; i <= stale; ++i) {
+			for (auto& timing : m_Timings)
+				timing.Slots[(m_CurrentSlot + i) % m_SlotCount].Clear();
+		}
+		m_CurrentSlot = slot;
+	}
+
+
+	void FrameStats::SetDump(double interval, const std::string& csvFile)
+	{
+		m_DumpInterval = std::max(interval, 0.0);
+		m_NextDump = Clock::Now() + Clock::SecondsToTicks(m_DumpInterval);
+
+		m_Csv.close();
+		if (m_DumpInterval > 0.0 && !csvFile.empty()) {
+			m_Csv.open(csvFile, std::ios::out | std::ios::trunc);
+			if (m_Csv.is_open())
+				m_Csv << "time_s,stat,count,p50_ms,p95_ms,p99_ms,max_ms,mean_ms\n";
+			else
+				LOG_CORE_WARN("FrameStats: Failed to open '{}', dumping to the log instead.", csvFile);
+		}
+
+		if (m_DumpInterval > 0.0)
+			LOG_CORE_DEBUG("FrameStats: Dumping every {}s to {}.", m_DumpInterval, m_Csv.is_open() ? csvFile : "the log");
+	}
+
+
+	void FrameStats::Tick()
+	{
+		if (m_DumpInterval <= 0.0)
+			return;
+
+		uint64_t now = Clock::Now();
+		if (now < m_NextDump)
+			return;
+
+		m_NextDump = now + Clock::SecondsToTicks(m_DumpInterval);
+		Dump();
+	}
+
+
+	void FrameStats::Dump()
+	{
+		HE_PROFILE_FUNCTION();
+
+		// Span since the last dump (whole window if dumping less often)
+		double span = (m_DumpInterval > 0.0) ? m_DumpInterval : GetWindow();
+		double time = Clock::TicksToSeconds(Clock::Now() - m_StartTicks);
+
+		for (size_t i = 0; i < static_cast<size_t>(FrameStat::Count); ++i)
+		{
+			FrameStat stat = static_cast<FrameStat>(i);
+			Summary s = GetSummary(stat, span);
+			if (s.Count == 0)
+				continue;
+
+			if (m_Csv.is_open()) {
+				m_Csv << fmt::format("{:.3f},{},{},{:.3f},{:.3f},{:.3f},{:.3f},{:.3f}\n",
+					time, GetName(stat), s.Count, s.P50, s.P95, s.P99, s.Max, s.Mean);
+			}
+			else {
+				LOG_CORE_INFO("FrameStats: {:<12} p50 {:7.3f}  p95 {:7.3f}  p99 {:7.3f}  max {:7.3f} ms ({} samples)",
+					GetName(stat), s.P50, s.P95, s.P99, s.Max, s.Count);
+			}
+		}
+
+		if (m_Csv.is_open())
+			m_Csv.flush();
+	}
+
+
+	const char* FrameStats::GetName(FrameStat stat)
+	{
+		switch (stat)
+		{
+			case FrameStat::Frame:        return "Frame";
+			case FrameStat::Update:       return "Update";
+			case FrameStat::RenderSubmit: return "RenderSubmit";
+			case FrameStat::FenceWait:    return "FenceWait";
+			case FrameStat::Present:      return "Present";
+			case FrameStat::GpuFrame:     return "GpuFrame";
+			case FrameStat::FrameReset:   return "FrameReset";
+			default:                      return "Unknown";
+		}
+	}
+
+
+} // namespace Helios::Engine
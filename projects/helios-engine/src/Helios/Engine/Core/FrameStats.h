@@ -0,0 +1,176 @@
+//==============================================================================
+// Frame Statistics
+//
+// Collects per-frame timings (CPU frame, update, render submit, GPU fence
+// wait, present) into fixed-bucket HDR histograms, so percentiles stay
+// accurate over the whole range from microseconds to seconds without storing
+// individual samples. Each timing keeps a ring of short histogram slots that
+// together form a sliding window; queries merge the slots of the requested
+// time span. Optionally dumps p50/p95/p99/max periodically to the log or to a
+// CSV file to track stutter in long running sessions.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Log-linear histogram, 1 us resolution, < 1% relative error, up to ~2 minutes
+// - Sliding windows (ring of slots), p50/p95/p99/max/mean per timing
+// - Thread-safe recording (main thread and render thread)
+// - Periodic dump to log or CSV (engine config section "FrameStats")
+//
+// Notes:
+// - RenderSubmit is the CPU time from the end of the fence wait to the start
+//   of present (acquire, command recording, queue submit).
+// - FrameReset is part of RenderSubmit. It is often close to the 1 us
+//   resolution, the mean over a window is the more useful figure.
+//
+// Changelog:
+// - 2026.10: Added frame resource reset time
+// - 2026.10: Added GPU frame time (timestamp queries)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Core/Clock.h"
+
+#include <array>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Helios::Engine {
+
+
+	enum class FrameStat : uint8_t
+	{
+		Frame,        // main loop iteration
+		Update,       // Layer::OnUpdate (incl. fixed updates)
+		RenderSubmit, // renderer CPU work for a frame
+		FenceWait,    // waiting for the GPU to release a frame in flight
+		Present,      // swapchain present
+		GpuFrame,     // GPU execution time of a frame (timestamp queries, reported frames later)
+		FrameReset,   // recycling the per-frame resources of a frame in flight (command pools, staging)
+		Count
+	};
+
+
+	// Log-linear histogram of microsecond values (HdrHistogram layout)
+	class FrameHistogram
+	{
+	public:
+		static constexpr uint32_t SubBucketBits = 7;
+		static constexpr uint32_t SubBucketCount = 1u << SubBucketBits;
+		static constexpr uint32_t SubBucketHalf = SubBucketCount / 2;
+		static constexpr uint32_t MaxShift = 20;
+		static constexpr uint32_t BucketCount = (MaxShift + 2) * SubBucketHalf;
+		static constexpr uint64_t MaxValue = (uint64_t(SubBucketCount) << MaxShift) - 1;
+
+		void Record(uint64_t micros);
+		void Merge(const FrameHistogram& other);
+		void Clear();
+
+		uint64_t GetCount() const { return m_Count; }
+		uint64_t GetMax() const { return m_Max; }
+		double GetMean() const { return m_Count ? static_cast<double>(m_Sum) / static_cast<double>(m_Count) : 0.0; }
+		// Value (highest equivalent) at the percentile (0..100)
+		uint64_t GetPercentile(double percentile) const;
+
+		static uint32_t GetIndex(uint64_t micros);
+		static uint64_t GetHighestEquivalent(uint32_t index);
+
+	private:
+		std::array<uint32_t, BucketCount> m_Buckets{};
+		uint64_t m_Count = 0;
+		uint64_t m_Sum = 0;
+		uint64_t m_Max = 0;
+	};
+
+
+	class FrameStats
+	{
+	public:
+		struct Summary
+		{
+			uint64_t Count = 0;
+			double P50 = 0.0; // milliseconds
+			double P95 = 0.0;
+			double P99 = 0.0;
+			double Max = 0.0;
+			double Mean = 0.0;
+		};
+
+		// 'window': sliding window length, split into 'slots' histograms
+		FrameStats(double window = 10.0, uint32_t slots = 10);
+		~FrameStats();
+
+		// Prevent copying and moving
+		FrameStats(const FrameStats&) = delete;
+		FrameStats& operator=(const FrameStats&) = delete;
+
+		// The instance owned by the Application (nullptr if none)
+		static FrameStats* Get() { return s_Instance; }
+
+		// Record a duration in Clock ticks, no-op without an instance
+		static void Record(FrameStat stat, uint64_t ticks)
+			{ if (s_Instance) s_Instance->Add(stat, ticks); }
+
+		void Add(FrameStat stat, uint64_t ticks);
+
+		// Percentiles over at least the last 'seconds' (0 = whole window, rounded up to slots)
+		Summary GetSummary(FrameStat stat, double seconds = 0.0);
+		double GetWindow() const { return m_SlotSeconds * m_SlotCount; }
+
+		// Periodic dump, called once per frame from the main loop
+		// interval 0 = off, empty file = log
+		void SetDump(double interval, const std::string& csvFile = "");
+		void Tick();
+		void Dump();
+
+		static const char* GetName(FrameStat stat);
+
+	private:
+		struct Timing
+		{
+			std::vector<FrameHistogram> Slots;
+		};
+
+		// Called with m_Mutex held
+		void Advance(uint64_t now);
+
+	private:
+		std::mutex m_Mutex;
+		std::array<Timing, static_cast<size_t>(FrameStat::Count)> m_Timings;
+		uint32_t m_SlotCount;
+		double m_SlotSeconds;
+		uint64_t m_SlotTicks;
+		uint64_t m_CurrentSlot = 0; // absolute slot number (time / slot length)
+		uint64_t m_StartTicks = 0;
+
+		double m_DumpInterval = 0.0;
+		uint64_t m_NextDump = 0;
+		std::ofstream m_Csv;
+
+	private:
+		static inline FrameStats* s_Instance = nullptr;
+	};
+
+
+	// Records the lifetime of the scope
+	class FrameStatScope
+	{
+	public:
+		FrameStatScope(FrameStat stat) : m_Stat(stat), m_Begin(Clock::Now()) {}
+		~FrameStatScope() { FrameStats::Record(m_Stat, Clock::Now() - m_Begin); }
+
+		// Prevent copying and moving
+		FrameStatScope(const FrameStatScope&) = delete;
+		FrameStatScope& operator=(const FrameStatScope&) = delete;
+
+	private:
+		FrameStat m_Stat;
+		uint64_t m_Begin;
+	};
+
+
+} // namespace Helios::Engine
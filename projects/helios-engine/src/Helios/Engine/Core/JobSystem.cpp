@@ -0,0 +1,253 @@
+//==============================================================================
+// Job System (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file JobSystem.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/JobSystem.h"
+
+namespace Helios::Engine {
+
+
+	namespace {
+
+		// Index of the queue owned by the current thread (0 = shared queue for non-worker threads)
+		thread_local uint32_t t_QueueIndex = 0;
+		// Owner of t_QueueIndex (guards against a thread-local from another JobSystem instance)
+		thread_local const JobSystem* t_Owner = nullptr;
+
+	} // namespace
+
+
+	JobSystem::JobSystem(uint32_t workerCount)
+	{
+		if (s_Instance)
+			LOG_CORE_EXCEPT("JobSystem already exists!");
+		s_Instance = this;
+
+		if (workerCount == 0) {
+			uint32_t hw = std::thread::hardware_concurrency();
+			workerCount = (hw > 1) ? hw - 1 : 1;
+		}
+
+		m_Queues.reserve(workerCount + 1);
+		for (uint32_t i = 0; i < workerCount + 1; ++i)
+			m_Queues.push_back(CreateScope<WorkQueue>());
+
+		m_Workers.reserve(workerCount);
+		for (uint32_t i = 0; i < workerCount; ++i)
+			m_Workers.emplace_back(&JobSystem::WorkerMain, this, i + 1);
+
+		LOG_CORE_DEBUG("JobSystem: Started {} worker thread(s).", workerCount);
+	}
+
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_Running = false;
+		}
+		m_SleepCondVar.notify_all();
+
+		// Workers drain the remaining jobs before they exit
+		for (auto& worker : m_Workers)
+			worker.join();
+		m_Workers.clear();
+
+		LOG_CORE_DEBUG("JobSystem: Stopped.");
+		s_Instance = nullptr;
+	}
+
+
+	bool JobSystem::IsWorkerThread() const
+	{
+		return t_Owner == this && t_QueueIndex != 0;
+	}
+
+
+	void JobSystem::Run(JobFunc job, JobCounter* counter)
+	{
+		if (counter)
+			AddRef(*counter);
+		Push({ std::move(job), counter });
+	}
+
+
+	void JobSystem::RunAfter(JobCounter& dependency, JobFunc job, JobCounter* counter)
+	{
+		if (counter)
+			AddRef(*counter);
+
+		{
+			// The final decrement in Execute() happens under the same mutex
+			std::lock_guard<std::mutex> lock(dependency.m_Mutex);
+			if (!dependency.IsDone()) {
+				dependency.m_Continuations.emplace_back(std::move(job), counter);
+				return;
+			}
+		}
+		Push({ std::move(job), counter });
+	}
+
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			Job job;
+			if (TryPop(job)) {
+				Execute(job);
+				continue;
+			}
+
+			// Nothing to help with: sleep until a counter finishes or new jobs are queued
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_Waiters++;
+			m_WaitCondVar.wait(lock, [this, &counter] {
+				return counter.IsDone() || m_QueuedJobs.load(std::memory_order_acquire) > 0;
+			});
+			m_Waiters--;
+		}
+
+		// The finishing job still holds the mutex after its decrement, the caller may destroy the counter next
+		std::lock_guard<std::mutex> lock(counter.m_Mutex);
+	}
+
+
+	void JobSystem::Push(Job job)
+	{
+		uint32_t index = (t_Owner == this) ? t_QueueIndex : 0;
+		{
+			// Counted under the queue lock, a thief cannot decrement before the increment
+			WorkQueue& queue = *m_Queues[index];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			m_QueuedJobs.fetch_add(1, std::memory_order_release);
+			queue.Jobs.push_back(std::move(job));
+		}
+
+		bool waiters = false;
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			waiters = m_Waiters > 0;
+		}
+		m_SleepCondVar.notify_one();
+		if (waiters)
+			m_WaitCondVar.notify_all();
+	}
+
+
+	bool JobSystem::TryPop(Job& out)
+	{
+		if (m_QueuedJobs.load(std::memory_order_acquire) == 0)
+			return false;
+
+		const uint32_t own = (t_Owner == this) ? t_QueueIndex : 0;
+		const uint32_t count = static_cast<uint32_t>(m_Queues.size());
+
+		// Own queue first (LIFO)
+		{
+			WorkQueue& queue = *m_Queues[own];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty()) {
+				out = std::move(queue.Jobs.back());
+				queue.Jobs.pop_back();
+				m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		// Steal from the others (FIFO), starting next to our own queue to spread contention
+		for (uint32_t i = 1; i < count; ++i)
+		{
+			WorkQueue& queue = *m_Queues[(own + i) % count];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+			if (!queue.Jobs.empty()) {
+				out = std::move(queue.Jobs.front());
+				queue.Jobs.pop_front();
+				m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+
+	void JobSystem::Execute(Job& job)
+	{
+		try {
+			HE_PROFILE_SCOPE("Job");
+			job.Func();
+		}
+		catch (const std::exception& e) {
+			LOG_CORE_ERROR("JobSystem: Job terminated with exception: {}", e.what());
+		}
+		catch (...) {
+			LOG_CORE_ERROR("JobSystem: Job terminated with unknown exception.");
+		}
+
+		if (!job.Counter)
+			return;
+
+		// Only the thread whose decrement reaches zero takes the continuations. Under the mutex, so
+		// RunAfter() either sees the counter busy and queues, or sees it done and runs the job itself
+		std::vector<std::pair<JobFunc, JobCounter*>> continuations;
+		bool finished = false;
+		{
+			JobCounter& counter = *job.Counter;
+			std::lock_guard<std::mutex> lock(counter.m_Mutex);
+			if (counter.m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				continuations.swap(counter.m_Continuations);
+				finished = true;
+			}
+		}
+
+		// The counter is not touched anymore, follow-up counters were incremented in RunAfter()
+		if (finished) {
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			if (m_Waiters > 0)
+				m_WaitCondVar.notify_all();
+		}
+		for (auto& [func, next] : continuations)
+			Push({ std::move(func), next });
+	}
+
+
+	void JobSystem::AddRef(JobCounter& counter)
+	{
+		counter.m_Count.fetch_add(1, std::memory_order_acq_rel);
+	}
+
+
+	void JobSystem::WorkerMain(uint32_t queueIndex)
+	{
+		t_QueueIndex = queueIndex;
+		t_Owner = this;
+		HE_PROFILE_THREAD("Job Worker");
+
+		while (true)
+		{
+			Job job;
+			if (TryPop(job)) {
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_SleepCondVar.wait(lock, [this] {
+				return m_QueuedJobs.load(std::memory_order_acquire) > 0 || !m_Running;
+			});
+			if (!m_Running && m_QueuedJobs.load(std::memory_order_acquire) == 0)
+				break;
+		}
+
+		t_Owner = nullptr;
+		t_QueueIndex = 0;
+	}
+
+
+} // namespace Helios::Engine
@@ -0,0 +1,175 @@
+//==============================================================================
+// Job System
+//
+// Provides an engine-wide work-stealing job scheduler. Each worker thread owns
+// a deque: it pushes and pops its own jobs at the back (LIFO, cache friendly)
+// while idle workers steal from the front of other deques (FIFO). Jobs are
+// tracked with JobCounters, which can be waited on (the waiting thread helps
+// executing jobs instead of blocking) and used as dependencies for follow-up
+// jobs. Owned by the Application and sized from the "engine" config domain or
+// the hardware concurrency.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Per-worker deques with work stealing
+// - JobCounter for completion tracking and job dependencies (RunAfter)
+// - Helping Wait() (no deadlock when waiting from inside a job), sleeps
+//   instead of spinning while the remaining jobs run on other threads
+// - ParallelFor with automatic batching
+// - Usable from any thread (non-worker threads submit to a shared queue)
+//
+// Notes:
+// - A counter may be destroyed or reused once Wait() on it returned. Polling
+//   IsDone() alone does not guarantee the finishing job is done with it.
+//
+// Usage:
+//   JobCounter counter;
+//   jobs.Run([] { ... }, &counter);
+//   jobs.RunAfter(counter, [] { ... });   // starts after the first job
+//   jobs.ParallelFor(count, 0, [&](uint32_t i) { ... });
+//   jobs.Wait(counter);
+//
+// Changelog:
+// - 2026.10: Queued job count raised before the push, Wait() sleeps when there is nothing to help with
+// - 2026.10: Fixed lost RunAfter continuations when the last jobs of a counter finish concurrently
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Util/ScopeRef.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Helios::Engine {
+
+
+	using JobFunc = std::function<void()>;
+
+
+	//------------------------------------------------------------------------------
+	// JobCounter - Tracks outstanding jobs, reaches zero when all are done
+	//------------------------------------------------------------------------------
+
+
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		~JobCounter() = default;
+		// Prevent copying and moving (jobs keep a pointer to the counter)
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+		uint32_t GetValue() const { return m_Count.load(std::memory_order_acquire); }
+
+	private:
+		friend class JobSystem;
+		std::atomic<uint32_t> m_Count = 0;
+		mutable std::mutex m_Mutex; // orders the final decrement against RunAfter and Wait
+		std::vector<std::pair<JobFunc, JobCounter*>> m_Continuations; // jobs waiting for this counter
+	};
+
+
+	//------------------------------------------------------------------------------
+	// JobSystem
+	//------------------------------------------------------------------------------
+
+
+	class JobSystem
+	{
+	public:
+		// workerCount = 0: hardware concurrency - 1 (the main thread helps in Wait())
+		JobSystem(uint32_t workerCount = 0);
+		~JobSystem();
+		// Prevent copying and moving
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// Access to the application-owned instance (nullptr if none exists)
+		static JobSystem* Get() { return s_Instance; }
+
+		uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+		bool IsWorkerThread() const;
+
+		// Schedule a job, counter (optional) is incremented now and decremented when the job finished
+		void Run(JobFunc job, JobCounter* counter = nullptr);
+
+		// Schedule a job once 'dependency' reached zero
+		void RunAfter(JobCounter& dependency, JobFunc job, JobCounter* counter = nullptr);
+
+		// Wait until the counter reached zero, executes pending jobs meanwhile
+		void Wait(const JobCounter& counter);
+
+		// Call fn(index) for index in [0, count), split into batches (batchSize = 0: automatic)
+		template<typename Fn>
+		void ParallelFor(uint32_t count, uint32_t batchSize, Fn&& fn);
+
+	private:
+		struct Job
+		{
+			JobFunc Func;
+			JobCounter* Counter = nullptr;
+		};
+
+		struct WorkQueue
+		{
+			std::mutex Mutex;
+			std::deque<Job> Jobs;
+		};
+
+		void Push(Job job);
+		bool TryPop(Job& out);
+		void Execute(Job& job);
+		void AddRef(JobCounter& counter);
+		void WorkerMain(uint32_t queueIndex);
+
+	private:
+		// [0] is shared by all non-worker threads, [1..N] belong to the workers
+		std::vector<Scope<WorkQueue>> m_Queues;
+		std::vector<std::thread> m_Workers;
+
+		std::atomic<bool> m_Running = true;
+		std::atomic<uint32_t> m_QueuedJobs = 0;
+		std::mutex m_SleepMutex;
+		std::condition_variable m_SleepCondVar; // idle workers
+		std::condition_variable m_WaitCondVar;  // Wait() callers with nothing to help with
+		uint32_t m_Waiters = 0;                 // guarded by m_SleepMutex
+
+		static inline JobSystem* s_Instance = nullptr;
+	};
+
+
+	template<typename Fn>
+	void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, Fn&& fn)
+	{
+		if (count == 0)
+			return;
+
+		// Aim for a few batches per thread so stealing can balance uneven work
+		if (batchSize == 0)
+			batchSize = std::max(1u, count / ((GetWorkerCount() + 1) * 4));
+
+		JobCounter counter;
+		for (uint32_t begin = 0; begin < count; begin += batchSize)
+		{
+			uint32_t end = std::min(begin + batchSize, count);
+			Run([&fn, begin, end] {
+				for (uint32_t i = begin; i < end; ++i)
+					fn(i);
+			}, &counter);
+		}
+		Wait(counter);
+	}
+
+
+} // namespace Helios::Engine
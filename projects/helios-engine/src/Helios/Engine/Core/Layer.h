@@ -4,13 +4,21 @@
 // Provides an abstract base class for application layers in the layer stack.
 // Layers receive lifecycle callbacks (OnAttach/OnDetach), per-frame updates
 // (OnUpdate with timestep), rendering callbacks (OnRender), and event
-// notifications (OnEvent). Enables modular composition of application
+// notifications (OnEvent). Layers can additionally receive fixed-rate
+// simulation steps (OnFixedUpdate) when the application runs in fixed timestep
+// mode; OnRender then reads the interpolation factor between the last two
+// simulation states from Application::GetRenderAlpha(). In event-driven mode a
+// layer keeps the main loop running continuously by returning true from
+// NeedsContinuousUpdate(). Enables modular composition of application
 // functionality with well-defined execution order.
 //
 // Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Added NeedsContinuousUpdate for the event-driven idle mode
+// - 2026.10: Added OnFixedUpdate (interpolation factor for OnRender via
+//   Application::GetRenderAlpha, the OnRender signature is unchanged)
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
@@ -32,9 +40,14 @@ namespace Helios::Engine {
 		virtual void OnDetach() {}
 		
 		virtual void OnUpdate(float /*timestep*/) {}
+		virtual void OnFixedUpdate(float /*timestep*/) {}
+		// Application::GetRenderAlpha(): blend factor between the previous and current fixed step
 		virtual void OnRender() {}
 
 		virtual void OnEvent(class Event& /*event*/) {}
+
+		// Event-driven mode only: true while the layer animates and needs frames without input
+		virtual bool NeedsContinuousUpdate() const { return false; }
 		
 	protected:
 		std::string m_Name;
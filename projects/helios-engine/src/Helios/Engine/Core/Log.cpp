@@ -8,6 +8,9 @@
 //==============================================================================
 #include "pch.h"
 #include "Helios/Engine/Core/Log.h"
+#include "Helios/Engine/Core/LogAsyncSink.h"
+#include "Helios/Engine/Core/LogDeferred.h"
+#include "Helios/Engine/Core/Config.h"
 
 #if (0 and defined(_MSC_VER))
 #	define USE_MSVC_SINK 1
@@ -48,8 +51,11 @@ namespace Helios::Engine {
 	// ----------------------------------------------------------------------------------------------------
 
 
-	void Log::Init(const std::string& filename, const std::string& path)
+	void Log::Init(const std::string& filename, const std::string& path, const LogAsyncSpec& async)
 	{
+		// Runtime levels start at the build default, ApplyConfig() may change them later
+		SetLevel(LOG_RUNTIME_LEVEL);
+
 		std::vector<spdlog::sink_ptr> logSinks;
 
 		std::string file = std::filesystem::path(
@@ -80,18 +86,31 @@ namespace Helios::Engine {
 			logSinks[2]->set_pattern("%T %4n:%-5!l >> %^%v%$");
 #		endif
 
+		// Asynchronous mode: formatting and I/O happen on the writer thread of the async sink.
+		// Only errors (and worse) flush, which then waits until the queue has been written.
+		auto flushLevel = spdlog::level::trace;
+		if (async.Enabled) {
+			s_AsyncSink = CreateRef<LogAsyncSink>(logSinks, async.QueueSize, async.Overflow);
+			logSinks = { s_AsyncSink };
+			flushLevel = spdlog::level::err;
+		}
+
+#		ifdef HE_LOG_DEFERRED
+			LogDeferred::Init();
+#		endif
+
 		// Logger for the Engine
 		s_CoreLogger = std::make_shared<spdlog::logger>("CORE", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_CoreLogger);
 		s_CoreLogger->set_level(spdlog::level::trace);
-		s_CoreLogger->flush_on(spdlog::level::trace);
+		s_CoreLogger->flush_on(flushLevel);
 		LOG_CORE_DEBUG("Log initialized");
 
 		// Logger for GLFW
 		s_GLFWLogger = std::make_shared<spdlog::logger>("GLFW", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_GLFWLogger);
 		s_GLFWLogger->set_level(spdlog::level::trace);
-		s_GLFWLogger->flush_on(spdlog::level::trace);
+		s_GLFWLogger->flush_on(flushLevel);
 		LOG_GLFW_DEBUG("Log initialized");
 
 		// Setup the error callback for GLFW
@@ -101,14 +120,14 @@ namespace Helios::Engine {
 		s_RenderLogger = std::make_shared<spdlog::logger>("REND", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_RenderLogger);
 		s_RenderLogger->set_level(spdlog::level::trace);
-		s_RenderLogger->flush_on(spdlog::level::trace);
+		s_RenderLogger->flush_on(flushLevel);
 		LOG_RENDER_DEBUG("Log initialized");
 
 		// Logger for the Application
 		s_AppLogger = std::make_shared<spdlog::logger>("APP ", begin(logSinks), end(logSinks));
 		spdlog::register_logger(s_AppLogger);
 		s_AppLogger->set_level(spdlog::level::trace);
-		s_AppLogger->flush_on(spdlog::level::trace);
+		s_AppLogger->flush_on(flushLevel);
 		LOG_DEBUG("Log initialized");
 	}
 
@@ -118,6 +137,9 @@ namespace Helios::Engine {
 		// Unregister GLFW error callback to avoid it invoking logging while we're tearing down
 		glfwSetErrorCallback(nullptr);
 
+		// decode pending deferred messages while the loggers still exist
+		LogDeferred::Shutdown();
+
 		LOG_CORE_INFO("Logging stopped.");
 
 		// flush existing loggers
@@ -126,6 +148,12 @@ namespace Helios::Engine {
 		if (s_RenderLogger) s_RenderLogger->flush();
 		if (s_AppLogger)    s_AppLogger->flush();
 
+		// write everything still queued and stop the writer thread
+		if (s_AsyncSink) {
+			s_AsyncSink->Stop();
+			s_AsyncSink.reset();
+		}
+
 		// remove named loggers from spdlog registry (optional but explicit)
 		try {
 			spdlog::drop("CORE");
@@ -149,4 +177,88 @@ namespace Helios::Engine {
 	}
 
 
+	// ----------------------------------------------------------------------------------------------------
+
+
+	void Log::SetLevel(LogCategory category, int level)
+	{
+		// Below the compile-time floor nothing would be logged anyway
+		level = std::clamp(level, static_cast<int>(LOG_LEVEL), static_cast<int>(LOG_LEVEL_OFF));
+		s_Levels[static_cast<size_t>(category)].store(level, std::memory_order_relaxed);
+	}
+
+
+	void Log::SetLevel(int level)
+	{
+		for (size_t i = 0; i < static_cast<size_t>(LogCategory::Count); ++i)
+			SetLevel(static_cast<LogCategory>(i), level);
+	}
+
+
+	void Log::ApplyConfig()
+	{
+		static constexpr std::pair<LogCategory, const char*> keys[] = {
+			{ LogCategory::Core,   "Core"   },
+			{ LogCategory::GLFW,   "GLFW"   },
+			{ LogCategory::App,    "App"    },
+			{ LogCategory::Render, "Render" },
+		};
+
+		auto& cfg = ConfigManager::GetInstance();
+		std::string all = cfg.Get<std::string>("engine", "Log", "Level", "");
+
+		for (const auto& [category, key] : keys)
+		{
+			std::string name = cfg.Get<std::string>("engine", "Log", key, all);
+			if (name.empty())
+				continue;
+
+			int level;
+			if (!ParseLevel(name, level)) {
+				LOG_CORE_WARN("Log: Unknown log level '{}' for '{}', ignored.", name, key);
+				continue;
+			}
+			if (level < LOG_LEVEL)
+				LOG_CORE_WARN("Log: Level '{}' for '{}' is below the compile-time level '{}', raised to it.", name, key, GetLevelName(LOG_LEVEL));
+
+			SetLevel(category, level);
+			LOG_CORE_DEBUG("Log: Runtime level for '{}' set to '{}'.", key, GetLevelName(GetLevel(category)));
+		}
+	}
+
+
+	const char* Log::GetLevelName(int level)
+	{
+		switch (level)
+		{
+			case LOG_LEVEL_TRACE: return "trace";
+			case LOG_LEVEL_DEBUG: return "debug";
+			case LOG_LEVEL_INFO:  return "info";
+			case LOG_LEVEL_WARN:  return "warn";
+			case LOG_LEVEL_ERROR: return "error";
+			case LOG_LEVEL_FATAL: return "fatal";
+			case LOG_LEVEL_OFF:   return "off";
+			default:              return "unknown";
+		}
+	}
+
+
+	bool Log::ParseLevel(const std::string& name, int& level)
+	{
+		std::string lower = name;
+		std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+		if      (lower == "trace")                          level = LOG_LEVEL_TRACE;
+		else if (lower == "debug")                          level = LOG_LEVEL_DEBUG;
+		else if (lower == "info")                           level = LOG_LEVEL_INFO;
+		else if (lower == "warn"  || lower == "warning")    level = LOG_LEVEL_WARN;
+		else if (lower == "error")                          level = LOG_LEVEL_ERROR;
+		else if (lower == "fatal" || lower == "critical")   level = LOG_LEVEL_FATAL;
+		else if (lower == "off")                            level = LOG_LEVEL_OFF;
+		else
+			return false;
+		return true;
+	}
+
+
 } // namespace Helios::Engine
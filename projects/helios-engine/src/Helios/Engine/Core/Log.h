@@ -5,7 +5,11 @@
 // log level filtering. Supports four logger categories (Core, GLFW, App,
 // Renderer) with standard log levels (TRACE, DEBUG, INFO, WARN, ERROR, FATAL).
 // Includes assertion macros with debugger break support and exception macros
-// that log and throw. Configurable output to file and console.
+// that log and throw. Configurable output to file and console. Optionally
+// writes asynchronously through LogAsyncSink so the calling thread only pays
+// for formatting the message text. On top of the compile-time floor each
+// logger has a runtime level (engine config section "Log" or Log::SetLevel),
+// checked with one relaxed atomic load before any argument is evaluated.
 //
 // Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
 // Part of the Helios Project - https://github.com/pernicius/helios-project
@@ -13,13 +17,36 @@
 // Main Features:
 // - Multi-category logging (Core/GLFW/App/Renderer)
 // - Compile-time log level filtering (zero overhead)
+// - Runtime log level per logger, configurable without recompilation
 // - spdlog backend with fmt formatting
 // - Assertion macros with debugger break
 // - Exception macros (log + throw)
-// - Build-aware level defaults (TRACE/INFO)
+// - Build-aware runtime level defaults (TRACE/INFO)
 // - File and console output
+// - Asynchronous mode with bounded lock-free queue and overflow policy
+// - Deferred-format binary logging for TRACE/DEBUG (HE_LOG_DEFERRED)
 // 
+// Notes:
+// - The runtime level can only raise the compile-time floor (LOG_LEVEL):
+//   TRACE in debug and INFO in release builds, so TRACE/DEBUG calls cost
+//   nothing in release. To diagnose them there, build with
+//   LOG_LEVEL=LOG_LEVEL_TRACE and raise the runtime level from the config.
+// - Log::Init() starts the runtime levels at LOG_RUNTIME_LEVEL (TRACE in debug,
+//   INFO in release builds), ApplyConfig() and SetLevel() change them
+//   afterwards. Levels below LOG_LEVEL are raised to it, so GetLevel() reports
+//   what is actually logged.
+// - Asynchronous mode is opt-in (LogAsyncSpec::Enabled or the command-line
+//   switch "log-async"). It only flushes on errors, so lines still queued when
+//   the process crashes are lost; the synchronous default flushes every line.
+//
 // Changelog:
+// - 2026.10: Compile-time floor back to INFO in release builds, runtime levels clamped to it
+// - 2026.10: Logging macros expand to one parenthesized expression
+// - 2026.10: Asynchronous logging is opt-in
+// - 2026.10: Compile-time floor TRACE in release builds, runtime default INFO
+// - 2026.10: Added runtime log levels per logger (LogCategory)
+// - 2026.10: Added deferred-format mode for LOG_CORE_/LOG_RENDER_ TRACE/DEBUG
+// - 2026.10: Added asynchronous logging (LogAsyncSpec)
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
@@ -34,10 +61,40 @@
 namespace Helios::Engine {
 
 
+	class LogAsyncSink;
+
+
+	enum class LogOverflowPolicy
+	{
+		Block,        // wait for the writer thread (no message is lost)
+		Drop,         // discard the new message silently
+		DropAndCount, // discard the new message, the writer reports the count
+	};
+
+
+	// Logger categories, one runtime level each
+	enum class LogCategory : uint8_t
+	{
+		Core,
+		GLFW,
+		App,
+		Render,
+		Count
+	};
+
+
+	struct LogAsyncSpec
+	{
+		bool Enabled = false;      // opt-in, see Notes
+		uint32_t QueueSize = 8192; // messages, rounded up to a power of two
+		LogOverflowPolicy Overflow = LogOverflowPolicy::Block;
+	};
+
+
 	class Log
 	{
 	public:
-		static void Init(const std::string& filename = "HeliosEngine.log", const std::string& path = "");
+		static void Init(const std::string& filename = "HeliosEngine.log", const std::string& path = "", const LogAsyncSpec& async = {});
 		static void Shutdown();
 
 		static Ref<spdlog::logger>& GetCoreLogger()   { return s_CoreLogger; }
@@ -45,11 +102,29 @@ namespace Helios::Engine {
 		static Ref<spdlog::logger>& GetAppLogger()    { return s_AppLogger; }
 		static Ref<spdlog::logger>& GetRenderLogger() { return s_RenderLogger; }
 
+		// Runtime levels (LOG_LEVEL_* values), thread-safe
+		static bool ShouldLog(LogCategory category, int level)
+			{ return level >= s_Levels[static_cast<size_t>(category)].load(std::memory_order_relaxed); }
+		static int GetLevel(LogCategory category)
+			{ return s_Levels[static_cast<size_t>(category)].load(std::memory_order_relaxed); }
+		static void SetLevel(LogCategory category, int level);
+		static void SetLevel(int level); // all categories
+
+		// Read the runtime levels from the engine config, section "Log":
+		// "Level" for all loggers, "Core", "GLFW", "App", "Render" per logger
+		// (trace, debug, info, warn, error, fatal, off)
+		static void ApplyConfig();
+
+		static const char* GetLevelName(int level);
+		static bool ParseLevel(const std::string& name, int& level);
+
 	private:
+		static inline std::atomic<int> s_Levels[static_cast<size_t>(LogCategory::Count)] = {};
 		static inline Ref<spdlog::logger> s_CoreLogger;
 		static inline Ref<spdlog::logger> s_GLFWLogger;
 		static inline Ref<spdlog::logger> s_AppLogger;
 		static inline Ref<spdlog::logger> s_RenderLogger;
+		static inline Ref<LogAsyncSink> s_AsyncSink;
 	};
 
 
@@ -57,15 +132,15 @@ namespace Helios::Engine {
 
 
 // log levels
-constexpr auto LOG_LEVEL_TRACE = 0; // should be used for Debug builds
+constexpr auto LOG_LEVEL_TRACE = 0; // default of Debug builds
 constexpr auto LOG_LEVEL_DEBUG = 1;
-constexpr auto LOG_LEVEL_INFO  = 2; // should be used for Release builds
+constexpr auto LOG_LEVEL_INFO  = 2; // default of Release builds
 constexpr auto LOG_LEVEL_WARN  = 3;
 constexpr auto LOG_LEVEL_ERROR = 4;
 constexpr auto LOG_LEVEL_FATAL = 5; // should never be used
 constexpr auto LOG_LEVEL_OFF   = 6; // should never be used
 
-// minimal log level
+// minimal log level (compile-time floor, everything below is stripped)
 #if !defined(LOG_LEVEL)
 #	ifdef BUILD_DEBUG
 #		define LOG_LEVEL LOG_LEVEL_TRACE
@@ -74,38 +149,66 @@ constexpr auto LOG_LEVEL_OFF   = 6; // should never be used
 #	endif
 #endif
 
+// runtime level set by Log::Init()
+#if !defined(LOG_RUNTIME_LEVEL)
+#	ifdef BUILD_DEBUG
+#		define LOG_RUNTIME_LEVEL LOG_LEVEL_TRACE
+#	else
+#		define LOG_RUNTIME_LEVEL LOG_LEVEL_INFO
+#	endif
+#endif
+
 //---------------------------------------
 // TODO: halt application on FATAL errors
 //---------------------------------------
 
+// Compile-time floor first (dead code is stripped), then the runtime level of the category
+#define HE_LOG_ENABLED(category, level) ((LOG_LEVEL <= level) && ::Helios::Engine::Log::ShouldLog(::Helios::Engine::LogCategory::category, level))
+
+// Deferred-format mode for the hot-path levels (see LogDeferred.h), opt-in
+#ifdef HE_LOG_DEFERRED
+#	include "Helios/Engine/Core/LogDeferred.h"
+#	define HE_LOG_DEFERRED_WRITE(logger, level, ...) ::Helios::Engine::LogDeferred::Write(logger.get(), level, __VA_ARGS__)
+#endif
+
 // Logging macros for HeliosEngine
-#define LOG_CORE_TRACE(...)   (LOG_LEVEL <= LOG_LEVEL_TRACE) ? ::Helios::Engine::Log::GetCoreLogger()->trace(__VA_ARGS__)      : (void)0
-#define LOG_CORE_DEBUG(...)   (LOG_LEVEL <= LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetCoreLogger()->debug(__VA_ARGS__)      : (void)0
-#define LOG_CORE_INFO(...)    (LOG_LEVEL <= LOG_LEVEL_INFO)  ? ::Helios::Engine::Log::GetCoreLogger()->info(__VA_ARGS__)       : (void)0
-#define LOG_CORE_WARN(...)    (LOG_LEVEL <= LOG_LEVEL_WARN)  ? ::Helios::Engine::Log::GetCoreLogger()->warn(__VA_ARGS__)       : (void)0
-#define LOG_CORE_ERROR(...)   (LOG_LEVEL <= LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetCoreLogger()->error(__VA_ARGS__)      : (void)0
-#define LOG_CORE_FATAL(...)   (LOG_LEVEL <= LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetCoreLogger()->critical(__VA_ARGS__)   : (void)0
+#ifdef HE_LOG_DEFERRED
+#	define LOG_CORE_TRACE(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_TRACE) ? HE_LOG_DEFERRED_WRITE(::Helios::Engine::Log::GetCoreLogger(), spdlog::level::trace, __VA_ARGS__) : (void)0)
+#	define LOG_CORE_DEBUG(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_DEBUG) ? HE_LOG_DEFERRED_WRITE(::Helios::Engine::Log::GetCoreLogger(), spdlog::level::debug, __VA_ARGS__) : (void)0)
+#else
+#	define LOG_CORE_TRACE(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_TRACE) ? ::Helios::Engine::Log::GetCoreLogger()->trace(__VA_ARGS__)      : (void)0)
+#	define LOG_CORE_DEBUG(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetCoreLogger()->debug(__VA_ARGS__)      : (void)0)
+#endif
+#define LOG_CORE_INFO(...)    (HE_LOG_ENABLED(Core, LOG_LEVEL_INFO)  ? ::Helios::Engine::Log::GetCoreLogger()->info(__VA_ARGS__)       : (void)0)
+#define LOG_CORE_WARN(...)    (HE_LOG_ENABLED(Core, LOG_LEVEL_WARN)  ? ::Helios::Engine::Log::GetCoreLogger()->warn(__VA_ARGS__)       : (void)0)
+#define LOG_CORE_ERROR(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetCoreLogger()->error(__VA_ARGS__)      : (void)0)
+#define LOG_CORE_FATAL(...)   (HE_LOG_ENABLED(Core, LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetCoreLogger()->critical(__VA_ARGS__)   : (void)0)
 
 // Logging macros for Application
-#define LOG_TRACE(...)        (LOG_LEVEL <= LOG_LEVEL_TRACE) ? ::Helios::Engine::Log::GetAppLogger()->trace(__VA_ARGS__)       : (void)0
-#define LOG_DEBUG(...)        (LOG_LEVEL <= LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetAppLogger()->debug(__VA_ARGS__)       : (void)0
-#define LOG_INFO(...)         (LOG_LEVEL <= LOG_LEVEL_INFO)  ? ::Helios::Engine::Log::GetAppLogger()->info(__VA_ARGS__)        : (void)0
-#define LOG_WARN(...)         (LOG_LEVEL <= LOG_LEVEL_WARN)  ? ::Helios::Engine::Log::GetAppLogger()->warn(__VA_ARGS__)        : (void)0
-#define LOG_ERROR(...)        (LOG_LEVEL <= LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetAppLogger()->error(__VA_ARGS__)       : (void)0
-#define LOG_FATAL(...)        (LOG_LEVEL <= LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetAppLogger()->critical(__VA_ARGS__)    : (void)0
+#define LOG_TRACE(...)        (HE_LOG_ENABLED(App, LOG_LEVEL_TRACE)  ? ::Helios::Engine::Log::GetAppLogger()->trace(__VA_ARGS__)       : (void)0)
+#define LOG_DEBUG(...)        (HE_LOG_ENABLED(App, LOG_LEVEL_DEBUG)  ? ::Helios::Engine::Log::GetAppLogger()->debug(__VA_ARGS__)       : (void)0)
+#define LOG_INFO(...)         (HE_LOG_ENABLED(App, LOG_LEVEL_INFO)   ? ::Helios::Engine::Log::GetAppLogger()->info(__VA_ARGS__)        : (void)0)
+#define LOG_WARN(...)         (HE_LOG_ENABLED(App, LOG_LEVEL_WARN)   ? ::Helios::Engine::Log::GetAppLogger()->warn(__VA_ARGS__)        : (void)0)
+#define LOG_ERROR(...)        (HE_LOG_ENABLED(App, LOG_LEVEL_ERROR)  ? ::Helios::Engine::Log::GetAppLogger()->error(__VA_ARGS__)       : (void)0)
+#define LOG_FATAL(...)        (HE_LOG_ENABLED(App, LOG_LEVEL_FATAL)  ? ::Helios::Engine::Log::GetAppLogger()->critical(__VA_ARGS__)    : (void)0)
 
 // Logging macros for GLFW
-#define LOG_GLFW_DEBUG(...)   (LOG_LEVEL <= LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetGLFWLogger()->debug(__VA_ARGS__)      : (void)0
-#define LOG_GLFW_ERROR(...)   (LOG_LEVEL <= LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetGLFWLogger()->error(__VA_ARGS__)      : (void)0
-#define LOG_GLFW_FATAL(...)   (LOG_LEVEL <= LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetGLFWLogger()->critical(__VA_ARGS__)   : (void)0
+#define LOG_GLFW_DEBUG(...)   (HE_LOG_ENABLED(GLFW, LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetGLFWLogger()->debug(__VA_ARGS__)      : (void)0)
+#define LOG_GLFW_ERROR(...)   (HE_LOG_ENABLED(GLFW, LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetGLFWLogger()->error(__VA_ARGS__)      : (void)0)
+#define LOG_GLFW_FATAL(...)   (HE_LOG_ENABLED(GLFW, LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetGLFWLogger()->critical(__VA_ARGS__)   : (void)0)
 
 // Logging macros for Renderer
-#define LOG_RENDER_TRACE(...) (LOG_LEVEL <= LOG_LEVEL_TRACE) ? ::Helios::Engine::Log::GetRenderLogger()->trace(__VA_ARGS__)    : (void)0
-#define LOG_RENDER_DEBUG(...) (LOG_LEVEL <= LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetRenderLogger()->debug(__VA_ARGS__)    : (void)0
-#define LOG_RENDER_INFO(...)  (LOG_LEVEL <= LOG_LEVEL_INFO)  ? ::Helios::Engine::Log::GetRenderLogger()->info(__VA_ARGS__)     : (void)0
-#define LOG_RENDER_WARN(...)  (LOG_LEVEL <= LOG_LEVEL_WARN)  ? ::Helios::Engine::Log::GetRenderLogger()->warn(__VA_ARGS__)     : (void)0
-#define LOG_RENDER_ERROR(...) (LOG_LEVEL <= LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetRenderLogger()->error(__VA_ARGS__)    : (void)0
-#define LOG_RENDER_FATAL(...) (LOG_LEVEL <= LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetRenderLogger()->critical(__VA_ARGS__) : (void)0
+#ifdef HE_LOG_DEFERRED
+#	define LOG_RENDER_TRACE(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_TRACE) ? HE_LOG_DEFERRED_WRITE(::Helios::Engine::Log::GetRenderLogger(), spdlog::level::trace, __VA_ARGS__) : (void)0)
+#	define LOG_RENDER_DEBUG(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_DEBUG) ? HE_LOG_DEFERRED_WRITE(::Helios::Engine::Log::GetRenderLogger(), spdlog::level::debug, __VA_ARGS__) : (void)0)
+#else
+#	define LOG_RENDER_TRACE(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_TRACE) ? ::Helios::Engine::Log::GetRenderLogger()->trace(__VA_ARGS__)    : (void)0)
+#	define LOG_RENDER_DEBUG(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_DEBUG) ? ::Helios::Engine::Log::GetRenderLogger()->debug(__VA_ARGS__)    : (void)0)
+#endif
+#define LOG_RENDER_INFO(...)  (HE_LOG_ENABLED(Render, LOG_LEVEL_INFO)  ? ::Helios::Engine::Log::GetRenderLogger()->info(__VA_ARGS__)     : (void)0)
+#define LOG_RENDER_WARN(...)  (HE_LOG_ENABLED(Render, LOG_LEVEL_WARN)  ? ::Helios::Engine::Log::GetRenderLogger()->warn(__VA_ARGS__)     : (void)0)
+#define LOG_RENDER_ERROR(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_ERROR) ? ::Helios::Engine::Log::GetRenderLogger()->error(__VA_ARGS__)    : (void)0)
+#define LOG_RENDER_FATAL(...) (HE_LOG_ENABLED(Render, LOG_LEVEL_FATAL) ? ::Helios::Engine::Log::GetRenderLogger()->critical(__VA_ARGS__) : (void)0)
 
 
 // ASSERT macros (assertions are always logged as fatal errors)
@@ -0,0 +1,226 @@
+//==============================================================================
+// Asynchronous Log Sink (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file LogAsyncSink.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/LogAsyncSink.h"
+
+namespace Helios::Engine {
+
+
+	LogAsyncSink::LogAsyncSink(std::vector<spdlog::sink_ptr> sinks, uint32_t queueSize, LogOverflowPolicy policy)
+		: m_Sinks(std::move(sinks))
+		, m_Policy(policy)
+	{
+		// Round up to a power of two
+		size_t capacity = 2;
+		while (capacity < queueSize)
+			capacity <<= 1;
+		m_Mask = capacity - 1;
+
+		// Preallocate everything, pushing a message must not allocate in the common case
+		m_Slots = std::make_unique<Slot[]>(capacity);
+		for (size_t i = 0; i < capacity; ++i) {
+			m_Slots[i].Sequence.store(i, std::memory_order_relaxed);
+			m_Slots[i].Payload.reserve(256);
+		}
+
+		m_Running = true;
+		m_Writer = std::thread(&LogAsyncSink::WriterMain, this);
+	}
+
+
+	LogAsyncSink::~LogAsyncSink()
+	{
+		Stop();
+	}
+
+
+	void LogAsyncSink::Stop()
+	{
+		if (!m_Running.exchange(false))
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_WriterMutex);
+		}
+		m_WriterCondVar.notify_all();
+		m_Writer.join();
+
+		// Whatever got queued while the writer shut down
+		while (WriteNext()) {}
+		ReportDropped();
+		for (auto& sink : m_Sinks)
+			sink->flush();
+	}
+
+
+	void LogAsyncSink::log(const spdlog::details::log_msg& msg)
+	{
+		if (!m_Running.load(std::memory_order_acquire)) {
+			WriteToSinks(msg);
+			return;
+		}
+
+		while (!TryPush(msg))
+		{
+			if (m_Policy != LogOverflowPolicy::Block) {
+				if (m_Policy == LogOverflowPolicy::DropAndCount)
+					m_Dropped.fetch_add(1, std::memory_order_relaxed);
+				m_DroppedTotal.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			if (!m_Running.load(std::memory_order_acquire)) {
+				WriteToSinks(msg); // writer stopped while we were waiting
+				return;
+			}
+			m_WriterCondVar.notify_one();
+			std::this_thread::yield();
+		}
+
+		if (m_WriterSleeping.load(std::memory_order_relaxed))
+			m_WriterCondVar.notify_one();
+	}
+
+
+	void LogAsyncSink::flush()
+	{
+		if (!m_Running.load(std::memory_order_acquire) || std::this_thread::get_id() == m_Writer.get_id()) {
+			for (auto& sink : m_Sinks)
+				sink->flush();
+			return;
+		}
+
+		// Wait until everything queued up to now has been written (the writer flushes after each batch)
+		const size_t target = m_EnqueuePos.load(std::memory_order_acquire);
+		while (m_DequeuePos.load(std::memory_order_acquire) < target && m_Running.load(std::memory_order_acquire))
+		{
+			m_WriterCondVar.notify_one();
+			std::this_thread::yield();
+		}
+		for (auto& sink : m_Sinks)
+			sink->flush();
+	}
+
+
+	void LogAsyncSink::set_pattern(const std::string& pattern)
+	{
+		for (auto& sink : m_Sinks)
+			sink->set_pattern(pattern);
+	}
+
+
+	void LogAsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> formatter)
+	{
+		for (auto& sink : m_Sinks)
+			sink->set_formatter(formatter->clone());
+	}
+
+
+	bool LogAsyncSink::TryPush(const spdlog::details::log_msg& msg)
+	{
+		// Bounded MPMC ring buffer (D. Vyukov), each slot carries a sequence number
+		Slot* slot = nullptr;
+		size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+		while (true)
+		{
+			slot = &m_Slots[pos & m_Mask];
+			size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+			intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+			if (diff == 0) {
+				if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0) {
+				return false; // full
+			}
+			else {
+				pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->Time = msg.time;
+		slot->ThreadID = msg.thread_id;
+		slot->Level = msg.level;
+		slot->Source = msg.source;
+		slot->LoggerName = msg.logger_name;
+		slot->Payload.assign(msg.payload.data(), msg.payload.size());
+		slot->Sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	bool LogAsyncSink::WriteNext()
+	{
+		// Single consumer: the writer thread, or Stop() after it has been joined
+		const size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+		Slot& slot = m_Slots[pos & m_Mask];
+		if (slot.Sequence.load(std::memory_order_acquire) != pos + 1)
+			return false;
+
+		spdlog::details::log_msg msg(slot.Time, slot.Source, slot.LoggerName, slot.Level,
+			spdlog::string_view_t(slot.Payload.data(), slot.Payload.size()));
+		msg.thread_id = slot.ThreadID;
+		WriteToSinks(msg);
+
+		slot.Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+		m_DequeuePos.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+
+	void LogAsyncSink::WriteToSinks(const spdlog::details::log_msg& msg)
+	{
+		for (auto& sink : m_Sinks) {
+			if (sink->should_log(msg.level))
+				sink->log(msg);
+		}
+	}
+
+
+	void LogAsyncSink::ReportDropped()
+	{
+		uint32_t dropped = m_Dropped.exchange(0, std::memory_order_relaxed);
+		if (dropped == 0)
+			return;
+
+		std::string text = fmt::format("{} log message(s) dropped, queue full", dropped);
+		spdlog::details::log_msg msg(spdlog::source_loc{}, "LOG ", spdlog::level::warn, text);
+		WriteToSinks(msg);
+	}
+
+
+	void LogAsyncSink::WriterMain()
+	{
+		while (true)
+		{
+			bool wrote = false;
+			while (WriteNext())
+				wrote = true;
+			ReportDropped();
+			if (wrote) {
+				for (auto& sink : m_Sinks)
+					sink->flush();
+			}
+
+			std::unique_lock<std::mutex> lock(m_WriterMutex);
+			if (!m_Running.load(std::memory_order_acquire))
+				break;
+
+			// Producers only notify while we sleep, the timeout covers the remaining race
+			m_WriterSleeping.store(true, std::memory_order_relaxed);
+			m_WriterCondVar.wait_for(lock, std::chrono::milliseconds(10), [this] {
+				const size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+				return m_Slots[pos & m_Mask].Sequence.load(std::memory_order_acquire) == pos + 1
+					|| !m_Running.load(std::memory_order_acquire);
+			});
+			m_WriterSleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+
+
+} // namespace Helios::Engine
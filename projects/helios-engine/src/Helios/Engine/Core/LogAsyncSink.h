@@ -0,0 +1,93 @@
+//==============================================================================
+// Asynchronous Log Sink
+//
+// spdlog sink that moves pattern formatting and I/O off the logging thread.
+// Messages are copied into a preallocated, bounded lock-free ring buffer
+// (multi-producer, single-consumer) and a dedicated writer thread forwards
+// them to the wrapped sinks (console, file, ...). When the queue is full the
+// configured overflow policy applies. Flush() waits until everything queued
+// so far has been written, so flush_on(err) keeps fatal messages safe.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Core/Log.h"
+
+#pragma warning(push, 0)
+#	include <spdlog/sinks/sink.h>
+#pragma warning(pop)
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Helios::Engine {
+
+
+	class LogAsyncSink final : public spdlog::sinks::sink
+	{
+	public:
+		LogAsyncSink(std::vector<spdlog::sink_ptr> sinks, uint32_t queueSize, LogOverflowPolicy policy);
+		~LogAsyncSink() override;
+
+		// Prevent copying and moving
+		LogAsyncSink(const LogAsyncSink&) = delete;
+		LogAsyncSink& operator=(const LogAsyncSink&) = delete;
+
+		// spdlog::sinks::sink
+		void log(const spdlog::details::log_msg& msg) override;
+		void flush() override;
+		void set_pattern(const std::string& pattern) override;
+		void set_formatter(std::unique_ptr<spdlog::formatter> formatter) override;
+
+		// Write everything queued and stop the writer thread (further messages are written synchronously)
+		void Stop();
+
+		uint64_t GetDroppedCount() const { return m_DroppedTotal.load(std::memory_order_relaxed); }
+
+	private:
+		struct Slot
+		{
+			std::atomic<size_t> Sequence = 0;
+			spdlog::log_clock::time_point Time;
+			size_t ThreadID = 0;
+			spdlog::level::level_enum Level = spdlog::level::off;
+			spdlog::source_loc Source;
+			spdlog::string_view_t LoggerName; // loggers outlive the sink's writer thread
+			std::string Payload;
+		};
+
+		bool TryPush(const spdlog::details::log_msg& msg);
+		bool WriteNext();
+		void WriteToSinks(const spdlog::details::log_msg& msg);
+		void ReportDropped();
+		void WriterMain();
+
+	private:
+		std::vector<spdlog::sink_ptr> m_Sinks;
+		LogOverflowPolicy m_Policy;
+
+		std::unique_ptr<Slot[]> m_Slots;
+		size_t m_Mask = 0;
+		alignas(64) std::atomic<size_t> m_EnqueuePos = 0;
+		alignas(64) std::atomic<size_t> m_DequeuePos = 0;
+
+		std::atomic<uint32_t> m_Dropped = 0;      // not yet reported
+		std::atomic<uint64_t> m_DroppedTotal = 0;
+
+		std::thread m_Writer;
+		std::mutex m_WriterMutex;
+		std::condition_variable m_WriterCondVar;
+		std::atomic<bool> m_WriterSleeping = false;
+		std::atomic<bool> m_Running = false;
+	};
+
+
+} // namespace Helios::Engine
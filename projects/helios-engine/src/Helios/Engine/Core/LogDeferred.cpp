@@ -0,0 +1,224 @@
+//==============================================================================
+// Deferred-Format Logging (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file LogDeferred.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/LogDeferred.h"
+
+#pragma warning(push, 0)
+#	include <spdlog/details/os.h>
+#pragma warning(pop)
+
+#include <condition_variable>
+#include <thread>
+
+namespace Helios::Engine {
+
+
+	namespace {
+
+		constexpr size_t Align8(size_t size) { return (size + 7) & ~size_t(7); }
+
+
+		// Byte ring buffer, written by the owning thread only, drained by the decoder thread only
+		struct ThreadBuffer
+		{
+			static constexpr size_t Capacity = 256 * 1024; // power of two
+			static constexpr size_t Mask = Capacity - 1;
+
+			alignas(8) std::array<uint8_t, Capacity> Data;
+			std::atomic<uint64_t> Head = 0; // bytes written (producer)
+			std::atomic<uint64_t> Tail = 0; // bytes consumed (consumer)
+			std::atomic<uint32_t> Dropped = 0;
+			uint64_t PendingHead = 0; // producer only, published by Commit()
+			size_t ThreadID = 0;
+		};
+
+
+		struct State
+		{
+			std::mutex Mutex; // guards Buffers
+			std::vector<Ref<ThreadBuffer>> Buffers;
+
+			// Clock ticks -> log clock
+			uint64_t BaseTicks = 0;
+			spdlog::log_clock::time_point BaseTime;
+
+			std::mutex DrainMutex; // one drain at a time (decoder thread or Flush)
+			std::thread Decoder;
+			std::mutex DecoderMutex;
+			std::condition_variable DecoderCondVar;
+			bool StopDecoder = false;
+		};
+
+
+		State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+
+		thread_local ThreadBuffer* t_Buffer = nullptr;
+
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!t_Buffer) {
+				State& state = GetState();
+				std::lock_guard<std::mutex> lock(state.Mutex);
+				auto buffer = CreateRef<ThreadBuffer>();
+				buffer->ThreadID = spdlog::details::os::thread_id();
+				state.Buffers.push_back(buffer);
+				// The registry keeps the buffer alive beyond the thread's lifetime
+				t_Buffer = buffer.get();
+			}
+			return *t_Buffer;
+		}
+
+	} // namespace
+
+
+	void LogDeferred::Init()
+	{
+		State& state = GetState();
+		state.BaseTicks = Clock::Now();
+		state.BaseTime = spdlog::log_clock::now();
+
+		state.StopDecoder = false;
+		state.Decoder = std::thread([&state] {
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(state.DecoderMutex);
+					state.DecoderCondVar.wait_for(lock, std::chrono::milliseconds(20), [&state] { return state.StopDecoder; });
+					if (state.StopDecoder)
+						break;
+				}
+				Flush();
+			}
+		});
+
+		s_Active.store(true, std::memory_order_release);
+	}
+
+
+	void LogDeferred::Shutdown()
+	{
+		if (!s_Active.exchange(false))
+			return;
+
+		State& state = GetState();
+		{
+			std::lock_guard<std::mutex> lock(state.DecoderMutex);
+			state.StopDecoder = true;
+		}
+		state.DecoderCondVar.notify_all();
+		state.Decoder.join();
+
+		Flush();
+	}
+
+
+	void LogDeferred::Flush()
+	{
+		State& state = GetState();
+		std::lock_guard<std::mutex> drainLock(state.DrainMutex);
+
+		std::vector<Ref<ThreadBuffer>> buffers;
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			buffers = state.Buffers;
+		}
+
+		for (auto& bufferRef : buffers)
+		{
+			ThreadBuffer& buffer = *bufferRef;
+
+			uint64_t tail = buffer.Tail.load(std::memory_order_relaxed);
+			const uint64_t head = buffer.Head.load(std::memory_order_acquire);
+			while (tail != head)
+			{
+				size_t offset = static_cast<size_t>(tail & ThreadBuffer::Mask);
+				if (ThreadBuffer::Capacity - offset < sizeof(RecordHeader)) {
+					tail += ThreadBuffer::Capacity - offset; // too small for a header, skipped by the producer
+					continue;
+				}
+
+				RecordHeader header;
+				std::memcpy(&header, buffer.Data.data() + offset, sizeof(header));
+				if (header.Decode) {
+					std::string text = header.Decode(std::string_view(header.Format, header.FormatSize), buffer.Data.data() + offset + sizeof(RecordHeader));
+
+					auto time = state.BaseTime + std::chrono::duration_cast<spdlog::log_clock::duration>(
+						std::chrono::duration<double>(Clock::TicksToSeconds(header.Ticks - state.BaseTicks)));
+					spdlog::details::log_msg msg(time, spdlog::source_loc{}, header.Logger->name(), header.Level, text);
+					msg.thread_id = buffer.ThreadID;
+					for (auto& sink : header.Logger->sinks()) {
+						if (sink->should_log(msg.level))
+							sink->log(msg);
+					}
+					if (header.Level >= header.Logger->flush_level())
+						header.Logger->flush();
+				}
+				tail += header.Size;
+			}
+			buffer.Tail.store(tail, std::memory_order_release);
+
+			uint32_t dropped = buffer.Dropped.exchange(0, std::memory_order_relaxed);
+			if (dropped)
+				LOG_CORE_WARN("LogDeferred: {} message(s) dropped, thread buffer full.", dropped);
+		}
+	}
+
+
+	uint8_t* LogDeferred::Begin(size_t payloadSize, RecordHeader*& header)
+	{
+		static_assert(sizeof(RecordHeader) % 8 == 0, "RecordHeader must keep records 8 byte aligned");
+
+		ThreadBuffer& buffer = GetThreadBuffer();
+		const size_t size = Align8(sizeof(RecordHeader) + payloadSize);
+
+		uint64_t head = buffer.Head.load(std::memory_order_relaxed);
+		const uint64_t tail = buffer.Tail.load(std::memory_order_acquire);
+
+		// Records never wrap, the rest of the buffer is skipped instead
+		size_t offset = static_cast<size_t>(head & ThreadBuffer::Mask);
+		size_t contiguous = ThreadBuffer::Capacity - offset;
+		size_t padding = (contiguous < size) ? contiguous : 0;
+
+		if (size > ThreadBuffer::Capacity / 2 || head + padding + size - tail > ThreadBuffer::Capacity) {
+			buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		if (padding) {
+			if (padding >= sizeof(RecordHeader)) {
+				RecordHeader skip{};
+				skip.Size = static_cast<uint32_t>(padding);
+				std::memcpy(buffer.Data.data() + offset, &skip, sizeof(skip));
+			}
+			head += padding;
+			offset = 0;
+		}
+
+		header = reinterpret_cast<RecordHeader*>(buffer.Data.data() + offset);
+		header->Size = static_cast<uint32_t>(size);
+		// Padding is published together with the record in Commit()
+		buffer.PendingHead = head + size;
+		return buffer.Data.data() + offset + sizeof(RecordHeader);
+	}
+
+
+	void LogDeferred::Commit()
+	{
+		ThreadBuffer& buffer = *t_Buffer;
+		buffer.Head.store(buffer.PendingHead, std::memory_order_release);
+	}
+
+
+} // namespace Helios::Engine
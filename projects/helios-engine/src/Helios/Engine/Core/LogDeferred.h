@@ -0,0 +1,223 @@
+//==============================================================================
+// Deferred-Format Logging
+//
+// Binary logging for hot paths. Instead of formatting on the calling thread,
+// a log call stores the address of its format string literal, a decoder for
+// its argument types and the raw argument bytes in a per-thread ring buffer
+// (single producer, no locks, no allocation). A background thread decodes the
+// records, formats them and hands them to the regular spdlog loggers with the
+// original timestamp. Used by the TRACE/DEBUG variants of LOG_CORE_* and
+// LOG_RENDER_* when HE_LOG_DEFERRED is defined.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Notes:
+// - Arithmetic, enum and pointer arguments are copied raw, strings are
+//   copied with a length prefix, any other type is formatted to a string on
+//   the calling thread (still correct, just not faster).
+// - Deferred lines are written with their original timestamp but may appear
+//   after immediate (INFO and above) lines logged later. Order is kept per
+//   thread, lines of different threads are grouped per decoder pass.
+// - If the per-thread buffer is full the record is dropped and counted.
+// - Format strings must be literals (only the address is stored).
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Core/Clock.h"
+
+#pragma warning(push, 0)
+#	include <spdlog/spdlog.h>
+#pragma warning(pop)
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace Helios::Engine {
+
+
+	class LogDeferred
+	{
+	public:
+		using DecodeFunc = std::string(*)(std::string_view format, const uint8_t* data);
+
+		// Called by Log::Init/Log::Shutdown
+		static void Init();
+		static void Shutdown();
+		static bool IsActive() { return s_Active.load(std::memory_order_acquire); }
+
+		// Write all records logged so far to the loggers
+		static void Flush();
+
+		template<typename... Args>
+		static void Write(spdlog::logger* logger, spdlog::level::level_enum level, spdlog::format_string_t<Args...> format, Args&&... args);
+
+		// Non-format overload (logger->trace(message) style)
+		template<typename T>
+		static void Write(spdlog::logger* logger, spdlog::level::level_enum level, const T& message);
+
+	private:
+		struct RecordHeader
+		{
+			DecodeFunc Decode;         // nullptr: padding up to the end of the buffer
+			const char* Format;
+			uint32_t FormatSize;
+			uint32_t Size;             // header + payload, 8 byte aligned
+			spdlog::logger* Logger;
+			uint64_t Ticks;
+			spdlog::level::level_enum Level;
+		};
+
+		// Reserve 'payloadSize' bytes in the calling thread's buffer, nullptr if full (dropped)
+		static uint8_t* Begin(size_t payloadSize, RecordHeader*& header);
+		static void Commit();
+
+	private:
+		//------------------------------------------------------------------------------
+		// Argument encoding
+		//------------------------------------------------------------------------------
+
+		template<typename T>
+		static constexpr bool IsRaw = (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>)
+			&& !std::is_same_v<T, const char*> && !std::is_same_v<T, char*>;
+
+		template<typename T>
+		static constexpr bool IsString = std::is_convertible_v<const T&, std::string_view>;
+
+		// Type an argument is decoded to
+		template<typename T>
+		using Decoded = std::conditional_t<IsRaw<T>, T, std::string>;
+
+		template<typename T>
+		static size_t EncodedSize(const T& arg)
+		{
+			if constexpr (IsRaw<T>)
+				return sizeof(T);
+			else if constexpr (IsString<T>)
+				return sizeof(uint32_t) + std::string_view(arg).size();
+			else
+				return sizeof(uint32_t) + fmt::formatted_size("{}", arg);
+		}
+
+		template<typename T>
+		static void Encode(uint8_t*& out, const T& arg)
+		{
+			if constexpr (IsRaw<T>) {
+				std::memcpy(out, &arg, sizeof(T));
+				out += sizeof(T);
+			}
+			else if constexpr (IsString<T>) {
+				std::string_view text(arg);
+				uint32_t size = static_cast<uint32_t>(text.size());
+				std::memcpy(out, &size, sizeof(size));
+				std::memcpy(out + sizeof(size), text.data(), size);
+				out += sizeof(size) + size;
+			}
+			else {
+				uint32_t size = static_cast<uint32_t>(fmt::formatted_size("{}", arg));
+				std::memcpy(out, &size, sizeof(size));
+				fmt::format_to(reinterpret_cast<char*>(out + sizeof(size)), "{}", arg);
+				out += sizeof(size) + size;
+			}
+		}
+
+		template<typename T>
+		static Decoded<T> DecodeArg(const uint8_t*& in)
+		{
+			if constexpr (IsRaw<T>) {
+				T value;
+				std::memcpy(&value, in, sizeof(T));
+				in += sizeof(T);
+				return value;
+			}
+			else {
+				uint32_t size;
+				std::memcpy(&size, in, sizeof(size));
+				std::string value(reinterpret_cast<const char*>(in + sizeof(size)), size);
+				in += sizeof(size) + size;
+				return value;
+			}
+		}
+
+		template<typename... Args>
+		static std::string Decode(std::string_view format, const uint8_t* data)
+		{
+			// Braced initialization evaluates left to right, matching the encoding order
+			std::tuple<Decoded<Args>...> values{ DecodeArg<Args>(data)... };
+			return std::apply([format](const auto&... v) {
+				return fmt::vformat(format, fmt::make_format_args(v...));
+			}, values);
+		}
+
+		template<typename... Args>
+		static void WriteImpl(spdlog::logger* logger, spdlog::level::level_enum level, std::string_view format, const Args&... args);
+
+	private:
+		static inline std::atomic<bool> s_Active = false;
+	};
+
+
+	template<typename... Args>
+	void LogDeferred::Write(spdlog::logger* logger, spdlog::level::level_enum level, spdlog::format_string_t<Args...> format, Args&&... args)
+	{
+		if (!logger->should_log(level))
+			return;
+
+		if (!IsActive()) {
+			logger->log(level, format, std::forward<Args>(args)...);
+			return;
+		}
+
+		// The format string points to the literal at the call site, which lives for the whole program
+		fmt::string_view text = format;
+		WriteImpl<std::decay_t<Args>...>(logger, level, std::string_view(text.data(), text.size()), args...);
+	}
+
+
+	template<typename T>
+	void LogDeferred::Write(spdlog::logger* logger, spdlog::level::level_enum level, const T& message)
+	{
+		if (!logger->should_log(level))
+			return;
+
+		if (!IsActive()) {
+			logger->log(level, message);
+			return;
+		}
+
+		if constexpr (IsString<T>)
+			WriteImpl<std::string_view>(logger, level, "{}", std::string_view(message));
+		else
+			WriteImpl<T>(logger, level, "{}", message);
+	}
+
+
+	template<typename... Args>
+	void LogDeferred::WriteImpl(spdlog::logger* logger, spdlog::level::level_enum level, std::string_view format, const Args&... args)
+	{
+		size_t payloadSize = (size_t(0) + ... + EncodedSize<Args>(args));
+
+		RecordHeader* header = nullptr;
+		uint8_t* out = Begin(payloadSize, header);
+		if (!out)
+			return;
+
+		header->Decode = &Decode<Args...>;
+		header->Format = format.data();
+		header->FormatSize = static_cast<uint32_t>(format.size());
+		header->Logger = logger;
+		header->Ticks = Clock::Now();
+		header->Level = level;
+		(Encode<Args>(out, args), ...);
+
+		Commit();
+	}
+
+
+} // namespace Helios::Engine
@@ -0,0 +1,289 @@
+//==============================================================================
+// Memory Tracker (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file MemoryTracker.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/MemoryTracker.h"
+
+#include <cstring>
+#include <new>
+
+namespace Helios::Engine {
+
+
+	namespace {
+
+		// Zero-initialized before any dynamic initialization, usable from the first allocation on
+		struct TagCounters
+		{
+			std::atomic<const char*> Name;
+			std::atomic<uint64_t> LiveBytes;
+			std::atomic<uint64_t> PeakBytes;
+			std::atomic<uint64_t> LiveCount;
+			std::atomic<uint64_t> TotalCount;
+			std::atomic<uint64_t> FrameCount;
+			std::atomic<uint64_t> FrameBytes;
+			std::atomic<uint64_t> LastFrameCount;
+			std::atomic<uint64_t> LastFrameBytes;
+		};
+
+		TagCounters g_Tags[MemoryTracker::MaxTags];
+		std::atomic<uint32_t> g_TagCount = 1; // 0 = untagged
+		std::atomic_flag g_RegisterLock = ATOMIC_FLAG_INIT;
+
+		thread_local uint32_t t_CurrentTag = MemoryTracker::UntaggedID;
+
+	} // namespace
+
+
+	uint32_t MemoryTracker::RegisterTag(const char* name)
+	{
+		// Spin lock: std::mutex may not be usable this early during static initialization
+		while (g_RegisterLock.test_and_set(std::memory_order_acquire)) {}
+
+		uint32_t count = g_TagCount.load(std::memory_order_relaxed);
+		uint32_t id = UntaggedID;
+		for (uint32_t i = 1; i < count; ++i) {
+			if (std::strcmp(g_Tags[i].Name.load(std::memory_order_relaxed), name) == 0) {
+				id = i;
+				break;
+			}
+		}
+		if (id == UntaggedID && count < MaxTags) {
+			id = count;
+			g_Tags[id].Name.store(name, std::memory_order_relaxed);
+			g_TagCount.store(count + 1, std::memory_order_release);
+		}
+
+		g_RegisterLock.clear(std::memory_order_release);
+		return id;
+	}
+
+
+	uint32_t MemoryTracker::GetCurrentTag()
+	{
+		return t_CurrentTag;
+	}
+
+
+	uint32_t MemoryTracker::SetCurrentTag(uint32_t tag)
+	{
+		uint32_t previous = t_CurrentTag;
+		t_CurrentTag = tag;
+		return previous;
+	}
+
+
+	void MemoryTracker::OnAllocate(uint32_t tag, uint64_t size)
+	{
+		TagCounters& counters = g_Tags[tag];
+		uint64_t live = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		counters.LiveCount.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalCount.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameCount.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameBytes.fetch_add(size, std::memory_order_relaxed);
+
+		uint64_t peak = counters.PeakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !counters.PeakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+	}
+
+
+	void MemoryTracker::OnFree(uint32_t tag, uint64_t size)
+	{
+		TagCounters& counters = g_Tags[tag];
+		counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+		counters.LiveCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+
+	void MemoryTracker::NextFrame()
+	{
+		uint32_t count = g_TagCount.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; ++i) {
+			g_Tags[i].LastFrameCount.store(g_Tags[i].FrameCount.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+			g_Tags[i].LastFrameBytes.store(g_Tags[i].FrameBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+
+	MemoryTracker::TagStats MemoryTracker::GetStats(uint32_t tag)
+	{
+		TagStats stats;
+		if (tag >= g_TagCount.load(std::memory_order_acquire))
+			return stats;
+
+		const TagCounters& counters = g_Tags[tag];
+		stats.Name       = (tag == UntaggedID) ? "Untagged" : counters.Name.load(std::memory_order_relaxed);
+		stats.LiveBytes  = counters.LiveBytes.load(std::memory_order_relaxed);
+		stats.PeakBytes  = counters.PeakBytes.load(std::memory_order_relaxed);
+		stats.LiveCount  = counters.LiveCount.load(std::memory_order_relaxed);
+		stats.TotalCount = counters.TotalCount.load(std::memory_order_relaxed);
+		stats.FrameCount = counters.LastFrameCount.load(std::memory_order_relaxed);
+		stats.FrameBytes = counters.LastFrameBytes.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+
+	std::vector<MemoryTracker::TagStats> MemoryTracker::GetAllStats()
+	{
+		std::vector<TagStats> result;
+		uint32_t count = g_TagCount.load(std::memory_order_acquire);
+		result.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+			result.push_back(GetStats(i));
+		return result;
+	}
+
+
+	MemoryTracker::TagStats MemoryTracker::GetTotal()
+	{
+		// The peak is the sum of the per-tag peaks (an upper bound of the real peak)
+		TagStats total;
+		total.Name = "Total";
+		for (const auto& stats : GetAllStats()) {
+			total.LiveBytes  += stats.LiveBytes;
+			total.PeakBytes  += stats.PeakBytes;
+			total.LiveCount  += stats.LiveCount;
+			total.TotalCount += stats.TotalCount;
+			total.FrameCount += stats.FrameCount;
+			total.FrameBytes += stats.FrameBytes;
+		}
+		return total;
+	}
+
+
+	void MemoryTracker::LogReport()
+	{
+		auto all = GetAllStats();
+		all.push_back(GetTotal());
+
+		LOG_CORE_INFO("MemoryTracker: {:<12} {:>12} {:>12} {:>10} {:>12} {:>10} {:>12}",
+			"Tag", "Live [KB]", "Peak [KB]", "Live #", "Total #", "Frame #", "Frame [KB]");
+		for (const auto& stats : all) {
+			LOG_CORE_INFO("MemoryTracker: {:<12} {:>12.1f} {:>12.1f} {:>10} {:>12} {:>10} {:>12.1f}",
+				stats.Name, stats.LiveBytes / 1024.0, stats.PeakBytes / 1024.0, stats.LiveCount,
+				stats.TotalCount, stats.FrameCount, stats.FrameBytes / 1024.0);
+		}
+	}
+
+
+} // namespace Helios::Engine
+
+
+//------------------------------------------------------------------------------
+// Global operator new/delete replacements
+//------------------------------------------------------------------------------
+
+#ifdef HE_MEMORY_TRACKING
+
+namespace {
+
+	using Helios::Engine::MemoryTracker;
+
+	// Placed directly in front of the returned pointer
+	struct alignas(16) AllocationHeader
+	{
+		uint64_t Size;
+		uint32_t Tag;
+		uint32_t Offset; // from the start of the raw allocation to the user pointer
+	};
+	static_assert(sizeof(AllocationHeader) == 16);
+
+
+	void* TrackedAllocate(size_t size, size_t alignment)
+	{
+		alignment = std::max(alignment, alignof(AllocationHeader));
+		const size_t offset = std::max(alignment, sizeof(AllocationHeader));
+
+		void* raw = nullptr;
+		if (alignment <= alignof(std::max_align_t)) {
+			raw = std::malloc(size + offset);
+		}
+		else {
+#		if defined(_MSC_VER)
+			raw = _aligned_malloc(size + offset, alignment);
+#		else
+			// aligned_alloc requires the size to be a multiple of the alignment
+			raw = std::aligned_alloc(alignment, (size + offset + alignment - 1) & ~(alignment - 1));
+#		endif
+		}
+		if (!raw)
+			return nullptr;
+
+		uint8_t* user = static_cast<uint8_t*>(raw) + offset;
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+		header->Size = size;
+		header->Tag = MemoryTracker::GetCurrentTag();
+		header->Offset = static_cast<uint32_t>(offset);
+
+		MemoryTracker::OnAllocate(header->Tag, size);
+		return user;
+	}
+
+
+	void TrackedFree(void* ptr, size_t alignment)
+	{
+		if (!ptr)
+			return;
+
+		AllocationHeader* header = static_cast<AllocationHeader*>(ptr) - 1;
+		MemoryTracker::OnFree(header->Tag, header->Size);
+
+		void* raw = static_cast<uint8_t*>(ptr) - header->Offset;
+		if (std::max(alignment, alignof(AllocationHeader)) <= alignof(std::max_align_t)) {
+			std::free(raw);
+		}
+		else {
+#		if defined(_MSC_VER)
+			_aligned_free(raw);
+#		else
+			std::free(raw);
+#		endif
+		}
+	}
+
+
+	void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+	{
+		while (true)
+		{
+			if (void* ptr = TrackedAllocate(size, alignment))
+				return ptr;
+
+			std::new_handler handler = std::get_new_handler();
+			if (!handler)
+				throw std::bad_alloc();
+			handler();
+		}
+	}
+
+} // namespace
+
+
+void* operator new  (size_t size)                                               { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size)                                               { return TrackedAllocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new  (size_t size, const std::nothrow_t&) noexcept               { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept               { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new  (size_t size, std::align_val_t align)                       { return TrackedAllocateOrThrow(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align)                       { return TrackedAllocateOrThrow(size, static_cast<size_t>(align)); }
+void* operator new  (size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(align)); }
+void* operator new[](size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return TrackedAllocate(size, static_cast<size_t>(align)); }
+
+void operator delete  (void* ptr) noexcept                                      { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* ptr) noexcept                                      { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete  (void* ptr, size_t) noexcept                              { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* ptr, size_t) noexcept                              { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete  (void* ptr, const std::nothrow_t&) noexcept               { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept               { TrackedFree(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void operator delete  (void* ptr, std::align_val_t align) noexcept              { TrackedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, std::align_val_t align) noexcept              { TrackedFree(ptr, static_cast<size_t>(align)); }
+void operator delete  (void* ptr, size_t, std::align_val_t align) noexcept      { TrackedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, size_t, std::align_val_t align) noexcept      { TrackedFree(ptr, static_cast<size_t>(align)); }
+void operator delete  (void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { TrackedFree(ptr, static_cast<size_t>(align)); }
+void operator delete[](void* ptr, std::align_val_t align, const std::nothrow_t&) noexcept { TrackedFree(ptr, static_cast<size_t>(align)); }
+
+#endif // HE_MEMORY_TRACKING
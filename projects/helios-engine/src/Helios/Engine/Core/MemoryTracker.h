@@ -0,0 +1,108 @@
+//==============================================================================
+// Memory Tracker
+//
+// Optional heap accounting. When HE_MEMORY_TRACKING is defined the global
+// operator new/delete are replaced by versions that prepend a small header to
+// every allocation, recording its size and the memory tag that was active on
+// the allocating thread. Tags are set with HE_MEMORY_TAG("VFS") for the rest
+// of the scope. Per tag the tracker keeps live bytes/allocations, peak bytes,
+// total allocations and the allocations of the current and last frame, so
+// allocation churn in the main loop and per-subsystem budgets become visible.
+// Without HE_MEMORY_TRACKING the macro compiles to nothing and new/delete are
+// untouched.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Global new/delete hooks (all variants incl. aligned and nothrow)
+// - Scoped memory tags (HE_MEMORY_TAG), nested scopes restore the outer tag
+// - Live/peak bytes, live/total counts and per-frame counts per tag
+// - Lock-free counters, no allocation inside the hooks
+// - Report to the log (MemoryTracker::LogReport)
+//
+// Notes:
+// - Memory is accounted to the tag active at allocation time, also when it
+//   is freed later by a different thread or scope.
+// - Only C++ heap allocations are seen (not malloc, driver or GPU memory).
+// - Tag names must have static storage duration (string literals).
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace Helios::Engine {
+
+
+	class MemoryTracker
+	{
+	public:
+		static constexpr uint32_t MaxTags = 64;
+		static constexpr uint32_t UntaggedID = 0;
+
+		struct TagStats
+		{
+			const char* Name = nullptr;
+			uint64_t LiveBytes = 0;
+			uint64_t PeakBytes = 0;
+			uint64_t LiveCount = 0;
+			uint64_t TotalCount = 0;
+			uint64_t FrameCount = 0; // allocations during the last completed frame
+			uint64_t FrameBytes = 0;
+		};
+
+		// Returns the ID of 'name' (registered on first use), UntaggedID if all tags are in use
+		static uint32_t RegisterTag(const char* name);
+
+		// Tag of the calling thread, used for the next allocations
+		static uint32_t GetCurrentTag();
+		static uint32_t SetCurrentTag(uint32_t tag); // returns the previous tag
+
+		// Close the current frame (per-frame counters), called once per frame from the main loop
+		static void NextFrame();
+
+		static TagStats GetStats(uint32_t tag);
+		static std::vector<TagStats> GetAllStats(); // all registered tags
+		static TagStats GetTotal();
+
+		static void LogReport();
+
+		// Bookkeeping for the operator new/delete replacements
+		static void OnAllocate(uint32_t tag, uint64_t size);
+		static void OnFree(uint32_t tag, uint64_t size);
+	};
+
+
+	class MemoryTagScope
+	{
+	public:
+		MemoryTagScope(uint32_t tag) : m_Previous(MemoryTracker::SetCurrentTag(tag)) {}
+		~MemoryTagScope() { MemoryTracker::SetCurrentTag(m_Previous); }
+
+		// Prevent copying and moving
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+	private:
+		uint32_t m_Previous;
+	};
+
+
+} // namespace Helios::Engine
+
+
+// Memory tag macros
+#ifdef HE_MEMORY_TRACKING
+#	define HE_MEMORY_CONCAT_INNER(a, b) a##b
+#	define HE_MEMORY_CONCAT(a, b)       HE_MEMORY_CONCAT_INNER(a, b)
+#	define HE_MEMORY_TAG(name) \
+		static const uint32_t HE_MEMORY_CONCAT(he_memory_tag_id_, __LINE__) = ::Helios::Engine::MemoryTracker::RegisterTag(name); \
+		::Helios::Engine::MemoryTagScope HE_MEMORY_CONCAT(he_memory_tag_, __LINE__)(HE_MEMORY_CONCAT(he_memory_tag_id_, __LINE__))
+#else
+#	define HE_MEMORY_TAG(name)
+#endif
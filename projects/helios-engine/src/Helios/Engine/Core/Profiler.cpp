@@ -0,0 +1,332 @@
+//==============================================================================
+// CPU Profiler (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file Profiler.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Core/Profiler.h"
+
+#include <condition_variable>
+#include <fstream>
+#include <thread>
+
+namespace Helios::Engine {
+
+
+	namespace {
+
+		struct ProfileEvent
+		{
+			const char* Name;
+			uint64_t Begin;
+			uint64_t End;
+		};
+
+
+		constexpr uint32_t RingCapacity = 1 << 14; // power of two
+		constexpr uint32_t RingMask = RingCapacity - 1;
+		using EventRing = std::array<ProfileEvent, RingCapacity>;
+
+
+		// Ring buffer, written by the owning thread only, drained by the writer thread only.
+		// The ring itself is taken from the pool on the first event, threads that never record
+		// while a session is active only cost this header
+		struct ThreadBuffer
+		{
+			std::atomic<EventRing*> Events = nullptr;
+			std::atomic<uint32_t> Head = 0; // next write position (producer)
+			std::atomic<uint32_t> Tail = 0; // next read position (consumer)
+			std::atomic<uint32_t> Dropped = 0;
+			std::atomic<bool> Exited = false; // owning thread is gone, release after the last drain
+
+			uint32_t ThreadID = 0;
+			std::string Name;        // guarded by State::Mutex
+			bool NameWritten = false; // writer thread only
+		};
+
+
+		struct State
+		{
+			std::mutex Mutex; // guards Buffers, FreeRings and thread names
+			std::vector<Ref<ThreadBuffer>> Buffers;
+			std::vector<std::unique_ptr<EventRing>> FreeRings; // rings of exited threads, freed at EndSession
+			uint32_t NextThreadID = 0;
+			std::mutex DrainMutex; // Drain() vs. releasing the buffer of an exiting thread
+
+			std::ofstream File;
+			bool FirstEvent = true;
+			uint64_t SessionStart = 0;
+
+			std::thread Writer;
+			std::mutex WriterMutex;
+			std::condition_variable WriterCondVar;
+			bool StopWriter = false;
+		};
+
+
+		State& GetState()
+		{
+			static State state;
+			return state;
+		}
+
+
+		// Caller holds State::Mutex, the buffer is no longer written
+		void ReleaseBuffer(State& state, ThreadBuffer& buffer)
+		{
+			if (EventRing* ring = buffer.Events.exchange(nullptr, std::memory_order_acq_rel))
+				state.FreeRings.emplace_back(ring);
+			std::erase_if(state.Buffers, [&buffer](const Ref<ThreadBuffer>& entry) { return entry.get() == &buffer; });
+		}
+
+
+		// Registers the thread's buffer on first use, hands it back when the thread exits
+		struct ThreadBufferOwner
+		{
+			ThreadBuffer* Buffer = nullptr;
+
+			~ThreadBufferOwner()
+			{
+				if (!Buffer)
+					return;
+
+				// Without a session nothing is left to drain, otherwise the writer releases it after the last drain
+				State& state = GetState();
+				std::lock_guard<std::mutex> drainLock(state.DrainMutex);
+				std::lock_guard<std::mutex> lock(state.Mutex);
+				if (Profiler::IsActive())
+					Buffer->Exited.store(true, std::memory_order_release);
+				else
+					ReleaseBuffer(state, *Buffer);
+			}
+		};
+
+		thread_local ThreadBufferOwner t_Owner;
+
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!t_Owner.Buffer) {
+				State& state = GetState();
+				std::lock_guard<std::mutex> lock(state.Mutex);
+				auto buffer = CreateRef<ThreadBuffer>();
+				buffer->ThreadID = state.NextThreadID++;
+				state.Buffers.push_back(buffer);
+				// The registry keeps the buffer alive until it was drained after the thread exited
+				t_Owner.Buffer = buffer.get();
+			}
+			return *t_Owner.Buffer;
+		}
+
+
+		EventRing* AcquireRing()
+		{
+			State& state = GetState();
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			if (state.FreeRings.empty())
+				return new EventRing;
+			EventRing* ring = state.FreeRings.back().release();
+			state.FreeRings.pop_back();
+			return ring;
+		}
+
+
+		void WriteEscaped(std::ofstream& out, const char* text)
+		{
+			for (const char* c = text; *c; ++c) {
+				if (*c == '"' || *c == '\\')
+					out << '\\';
+				out << *c;
+			}
+		}
+
+
+		// Writer thread only (or after it stopped)
+		void Drain(State& state)
+		{
+			std::lock_guard<std::mutex> drainLock(state.DrainMutex);
+
+			std::vector<Ref<ThreadBuffer>> buffers;
+			std::vector<std::string> names;
+			{
+				std::lock_guard<std::mutex> lock(state.Mutex);
+				buffers = state.Buffers;
+				for (auto& buffer : buffers)
+					names.push_back(buffer->Name);
+			}
+
+			auto& out = state.File;
+			auto separator = [&state, &out] {
+				if (!state.FirstEvent)
+					out << ",\n";
+				state.FirstEvent = false;
+			};
+
+			for (size_t i = 0; i < buffers.size(); ++i)
+			{
+				ThreadBuffer& buffer = *buffers[i];
+
+				if (!buffer.NameWritten && !names[i].empty()) {
+					separator();
+					out << R"({"name":"thread_name","ph":"M","pid":0,"tid":)" << buffer.ThreadID << R"(,"args":{"name":")";
+					WriteEscaped(out, names[i].c_str());
+					out << R"("}})";
+					buffer.NameWritten = true;
+				}
+
+				// Exited before the drain: everything it recorded is below head
+				const bool exited = buffer.Exited.load(std::memory_order_acquire);
+				const EventRing* events = buffer.Events.load(std::memory_order_acquire);
+				uint32_t tail = buffer.Tail.load(std::memory_order_relaxed);
+				const uint32_t head = buffer.Head.load(std::memory_order_acquire);
+				for (; events && tail != head; ++tail)
+				{
+					const ProfileEvent& e = (*events)[tail & RingMask];
+					if (e.Begin < state.SessionStart)
+						continue; // scope started in a previous session
+					// Chrome trace timestamps are microseconds
+					double ts = Clock::TicksToMicroseconds(e.Begin - state.SessionStart);
+					double dur = Clock::TicksToMicroseconds(e.End - e.Begin);
+
+					separator();
+					out << R"({"name":")";
+					WriteEscaped(out, e.Name);
+					out << R"(","cat":"cpu","ph":"X","pid":0,"tid":)" << buffer.ThreadID
+						<< R"(,"ts":)" << ts << R"(,"dur":)" << dur << "}";
+				}
+				buffer.Tail.store(tail, std::memory_order_release);
+
+				if (exited) {
+					std::lock_guard<std::mutex> lock(state.Mutex);
+					ReleaseBuffer(state, buffer);
+				}
+			}
+			out.flush();
+		}
+
+
+		void WriterMain()
+		{
+			State& state = GetState();
+			while (true)
+			{
+				{
+					std::unique_lock<std::mutex> lock(state.WriterMutex);
+					state.WriterCondVar.wait_for(lock, std::chrono::milliseconds(100), [&state] { return state.StopWriter; });
+					if (state.StopWriter)
+						break;
+				}
+				Drain(state);
+			}
+		}
+
+	} // namespace
+
+
+	bool Profiler::BeginSession(const std::string& filename)
+	{
+		if (IsActive())
+			EndSession();
+
+		State& state = GetState();
+		state.File.open(filename, std::ios::out | std::ios::trunc);
+		if (!state.File.is_open()) {
+			LOG_CORE_ERROR("Profiler: Failed to open '{}' for writing.", filename);
+			return false;
+		}
+		state.File << std::fixed;
+		state.File.precision(3);
+		state.File << R"({"displayTimeUnit":"ms","traceEvents":[)" << "\n";
+		state.FirstEvent = true;
+		state.SessionStart = Now();
+
+		// Discard events left over from a previous session
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			for (auto& buffer : state.Buffers) {
+				buffer->Tail.store(buffer->Head.load(std::memory_order_acquire), std::memory_order_release);
+				buffer->Dropped = 0;
+				buffer->NameWritten = false;
+			}
+		}
+
+		state.StopWriter = false;
+		state.Writer = std::thread(WriterMain);
+		s_Active.store(true, std::memory_order_release);
+
+		LOG_CORE_INFO("Profiler: Session started, writing to '{}'.", filename);
+		return true;
+	}
+
+
+	void Profiler::EndSession()
+	{
+		if (!IsActive())
+			return;
+		s_Active.store(false, std::memory_order_release);
+
+		State& state = GetState();
+		{
+			std::lock_guard<std::mutex> lock(state.WriterMutex);
+			state.StopWriter = true;
+		}
+		state.WriterCondVar.notify_all();
+		state.Writer.join();
+
+		Drain(state);
+		state.File << "\n]}\n";
+		state.File.close();
+
+		uint64_t dropped = 0;
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			for (auto& buffer : state.Buffers)
+				dropped += buffer->Dropped.load(std::memory_order_relaxed);
+		}
+		if (dropped)
+			LOG_CORE_WARN("Profiler: {} event(s) dropped, buffers were full.", dropped);
+
+		// Rings of threads that exited during the session (live threads keep theirs until they exit)
+		{
+			std::lock_guard<std::mutex> lock(state.Mutex);
+			state.FreeRings.clear();
+		}
+		LOG_CORE_INFO("Profiler: Session ended.");
+	}
+
+
+	void Profiler::SetThreadName(const char* name)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(GetState().Mutex);
+		buffer.Name = name;
+	}
+
+
+	void Profiler::Record(const char* name, uint64_t begin, uint64_t end)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+
+		// Only the owning thread stores a ring
+		EventRing* events = buffer.Events.load(std::memory_order_relaxed);
+		if (!events) {
+			events = AcquireRing();
+			buffer.Events.store(events, std::memory_order_release);
+		}
+
+		const uint32_t head = buffer.Head.load(std::memory_order_relaxed);
+		const uint32_t tail = buffer.Tail.load(std::memory_order_acquire);
+		if (head - tail >= RingCapacity) {
+			buffer.Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		(*events)[head & RingMask] = { name, begin, end };
+		buffer.Head.store(head + 1, std::memory_order_release);
+	}
+
+
+} // namespace Helios::Engine
@@ -0,0 +1,113 @@
+//==============================================================================
+// CPU Profiler
+//
+// Provides scoped CPU instrumentation (HE_PROFILE_SCOPE/HE_PROFILE_FUNCTION).
+// Each thread records begin/end timestamps into its own fixed-size ring
+// buffer (single producer, single consumer, no locks on the hot path). While
+// a session is active a background thread drains all buffers and streams the
+// events to a Chrome trace JSON file, which can be opened in chrome://tracing
+// or https://ui.perfetto.dev. When HE_PROFILE_ENABLED is not defined the
+// macros compile to nothing.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Zero-cost when disabled at compile time, one relaxed atomic load when idle
+// - Per-thread lock-free ring buffers (events are dropped and counted if full),
+//   allocated on the first event of a session, pooled when the thread exits
+// - Background writer thread (Chrome trace event format)
+// - Named threads in the trace (SetThreadName)
+//
+// Notes:
+// - Scope names must have static storage duration (string literals,
+//   __FUNCTION__), only the pointer is recorded.
+// - Without an active session a thread costs a small registry entry only
+//   (HE_PROFILE_THREAD names it), the ring (~400 KB) is only allocated when
+//   the thread records during a session. It stays with the thread until the
+//   thread exits; pooled rings are freed at EndSession.
+//
+// Changelog:
+// - 2026.10: Rings allocated lazily on the first recorded event, released when the thread exits
+// - 2026.10: Timestamps from Clock ticks
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Core/Clock.h"
+
+#include <atomic>
+#include <string>
+
+// Enabled by default in debug builds, define HE_PROFILE_ENABLED to profile release builds
+#if !defined(HE_PROFILE_ENABLED)
+#	ifdef BUILD_DEBUG
+#		define HE_PROFILE_ENABLED
+#	endif
+#endif
+
+namespace Helios::Engine {
+
+
+	class Profiler
+	{
+	public:
+		// Start streaming events to 'filename' (physical path), returns false on error
+		static bool BeginSession(const std::string& filename);
+		static void EndSession();
+		static bool IsActive() { return s_Active.load(std::memory_order_relaxed); }
+
+		// Name of the calling thread in the trace
+		static void SetThreadName(const char* name);
+
+		// Timestamp in Clock ticks (profiler time base)
+		static uint64_t Now() { return Clock::Now(); }
+
+		// Record a completed scope of the calling thread
+		static void Record(const char* name, uint64_t begin, uint64_t end);
+
+	private:
+		static inline std::atomic<bool> s_Active = false;
+	};
+
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name)
+			: m_Name(name)
+			, m_Begin(Profiler::IsActive() ? Profiler::Now() : 0)
+		{
+		}
+
+		~ProfileScope()
+		{
+			if (m_Begin && Profiler::IsActive())
+				Profiler::Record(m_Name, m_Begin, Profiler::Now());
+		}
+
+		// Prevent copying and moving
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		const char* m_Name;
+		uint64_t m_Begin;
+	};
+
+
+} // namespace Helios::Engine
+
+
+// Profiling macros
+#ifdef HE_PROFILE_ENABLED
+#	define HE_PROFILE_CONCAT_INNER(a, b) a##b
+#	define HE_PROFILE_CONCAT(a, b)       HE_PROFILE_CONCAT_INNER(a, b)
+#	define HE_PROFILE_SCOPE(name)        ::Helios::Engine::ProfileScope HE_PROFILE_CONCAT(he_profile_scope_, __LINE__)(name)
+#	define HE_PROFILE_FUNCTION()         HE_PROFILE_SCOPE(__FUNCTION__)
+#	define HE_PROFILE_THREAD(name)       ::Helios::Engine::Profiler::SetThreadName(name)
+#else
+#	define HE_PROFILE_SCOPE(name)
+#	define HE_PROFILE_FUNCTION()
+#	define HE_PROFILE_THREAD(name)
+#endif
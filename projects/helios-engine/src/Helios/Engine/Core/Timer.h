@@ -1,20 +1,24 @@
 //==============================================================================
 // High-Resolution Timer
 //
-// Provides a templated timer class built on std::chrono::high_resolution_clock
-// with configurable time resolution (seconds, milliseconds, microseconds).
-// Supports start/stop/reset operations and elapsed time queries. Returns
-// elapsed time as floating-point values in the specified Period. Useful for
-// performance measurements and frame timing.
+// Provides a templated timer class built on the engine Clock (TSC/CNTVCT with
+// steady_clock fallback) with configurable time resolution (seconds,
+// milliseconds, microseconds). Supports start/stop/reset operations and
+// elapsed time queries. Time is stored as integer ticks; Elapsed() returns a
+// float in the specified Period, ElapsedSeconds() a double for long-running
+// measurements. Useful for performance measurements and frame timing.
 //
 // Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Switched to Clock ticks, added ElapsedTicks/ElapsedSeconds
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
 
+#include "Helios/Engine/Core/Clock.h"
+
 #include <chrono>
 
 namespace Helios::Engine {
@@ -27,7 +31,7 @@ namespace Helios::Engine {
 		using resolution_t = std::chrono::duration<float, Period>;
 
 		Timer()
-			: m_StartTimePoint(std::chrono::high_resolution_clock::now())
+			: m_StartTicks(Clock::Now())
 			, m_Stopped(false)
 		{
 		}
@@ -35,25 +39,45 @@ namespace Helios::Engine {
 		float Stop()
 		{
 			m_Stopped = true;
-			m_EndTimePoint = std::chrono::high_resolution_clock::now();
+			m_EndTicks = Clock::Now();
 			return Elapsed();
 		}
 
 		void Reset()
 		{
-			m_StartTimePoint = std::chrono::high_resolution_clock::now();
+			m_StartTicks = Clock::Now();
+			m_Stopped = false;
+		}
+
+		// Restart and return the elapsed seconds up to now (no time lost between both calls)
+		double Lap()
+		{
+			uint64_t now = Clock::Now();
+			uint64_t elapsed = now - m_StartTicks;
+			m_StartTicks = now;
 			m_Stopped = false;
+			return Clock::TicksToSeconds(elapsed);
+		}
+
+		uint64_t ElapsedTicks() const
+		{
+			uint64_t endTicks = m_Stopped ? m_EndTicks : Clock::Now();
+			return endTicks - m_StartTicks;
+		}
+
+		double ElapsedSeconds() const
+		{
+			return Clock::TicksToSeconds(ElapsedTicks());
 		}
 
 		float Elapsed() const
 		{
-			auto endTimePoint = m_Stopped ? m_EndTimePoint : std::chrono::high_resolution_clock::now();
-			return std::chrono::duration<float, Period>(endTimePoint - m_StartTimePoint).count();
+			return static_cast<float>(ElapsedSeconds() * Period::den / Period::num);
 		}
 
 	private:
-		std::chrono::time_point<std::chrono::high_resolution_clock> m_StartTimePoint;
-		std::chrono::time_point<std::chrono::high_resolution_clock> m_EndTimePoint;
+		uint64_t m_StartTicks = 0;
+		uint64_t m_EndTicks = 0;
 		bool m_Stopped = false;
 	};
 
@@ -2,14 +2,16 @@
 // Timestep Wrapper
 //
 // Provides a lightweight wrapper for delta time values passed to layer update
-// callbacks. Stores time in seconds as a float and provides implicit conversion
-// to float for convenient arithmetic operations. Designed for use with frame
+// callbacks. Stores time in seconds as a double (no precision loss over long
+// sessions) and provides implicit conversion to float for convenient
+// arithmetic operations. Designed for use with frame
 // timing and fixed timestep game loops.
 //
 // Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Store seconds as double, added GetSeconds/GetMilliseconds
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
@@ -20,17 +22,17 @@ namespace Helios::Engine {
 	class Timestep
 	{
 	public:
-		Timestep(float time = 0.0f)
+		Timestep(double time = 0.0)
 			: m_Time(time)
 		{
 		}
 
-		operator float() const { return m_Time; }
-//		float GetSeconds() const { return m_Time; }
-//		float GetMilliseconds() const { return m_Time * 1000.0f; }
+		operator float() const { return static_cast<float>(m_Time); }
+		double GetSeconds() const { return m_Time; }
+		double GetMilliseconds() const { return m_Time * 1000.0; }
 
 	private:
-		float m_Time;
+		double m_Time;
 	};
 
 
@@ -11,6 +11,8 @@
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Version history:
+// - 2026.10: Added MemoryTracker.h
+// - 2026.10: Added Profiler.h
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
@@ -64,6 +66,8 @@
 
 // Engine includes
 #include "Helios/Engine/Core/Log.h"
+#include "Helios/Engine/Core/Profiler.h"
+#include "Helios/Engine/Core/MemoryTracker.h"
 #include "Helios/Engine/Core/Application.h"
 #include "Helios/Engine/Core/Version.h"
 
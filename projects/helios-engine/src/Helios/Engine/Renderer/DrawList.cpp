@@ -0,0 +1,125 @@
+//==============================================================================
+// Draw List (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file DrawList.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Renderer/DrawList.h"
+
+namespace Helios::Engine::Renderer {
+
+
+	namespace {
+
+		// Key bits above the instance index, sorted in 8-bit digits
+		constexpr uint32_t KeyShift = 24;
+		constexpr uint32_t DigitBits = 8;
+		constexpr uint32_t DigitCount = (64 - KeyShift) / DigitBits;
+		constexpr uint32_t DigitMask = (1u << DigitBits) - 1;
+
+	} // anonymous namespace
+
+
+	uint64_t DrawList::MakeKey(const DrawInstance& instance, uint32_t index)
+	{
+		return (static_cast<uint64_t>(instance.Pipeline & (MaxDrawPipelines - 1)) << 56) |
+			(static_cast<uint64_t>(instance.Material & (MaxDrawMaterials - 1)) << 40) |
+			(static_cast<uint64_t>(instance.Mesh & (MaxDrawMeshes - 1)) << KeyShift) |
+			static_cast<uint64_t>(index);
+	}
+
+
+	void DrawList::Submit(const DrawInstance* instances, size_t count)
+	{
+		if (count == 0)
+			return;
+
+		const size_t first = m_Instances.size();
+		if (first + count > MaxDrawInstances) {
+			LOG_RENDER_EXCEPT("DrawList: More than {} instances submitted in one frame.", MaxDrawInstances);
+		}
+
+		m_Instances.insert(m_Instances.end(), instances, instances + count);
+		m_Keys.resize(first + count);
+		for (size_t i = 0; i < count; i++)
+			m_Keys[first + i] = MakeKey(instances[i], static_cast<uint32_t>(first + i));
+	}
+
+
+	void DrawList::Clear()
+	{
+		m_Instances.clear();
+		m_Keys.clear();
+	}
+
+
+	void DrawSorter::Sort(const DrawList& list)
+	{
+		HE_PROFILE_FUNCTION();
+
+		const std::vector<uint64_t>& keys = list.GetKeys();
+		const uint32_t count = static_cast<uint32_t>(keys.size());
+
+		m_Sorted.assign(keys.begin(), keys.end());
+		m_Scratch.resize(count);
+		m_Batches.clear();
+		m_Passes = 0;
+		if (count == 0)
+			return;
+
+		// Histograms of all digits in one read, the counts do not depend on the order
+		std::array<std::array<uint32_t, 1u << DigitBits>, DigitCount> histograms = {};
+		for (uint64_t key : m_Sorted) {
+			for (uint32_t digit = 0; digit < DigitCount; digit++)
+				histograms[digit][(key >> (KeyShift + digit * DigitBits)) & DigitMask]++;
+		}
+
+		// Stable scatter per digit, the index bits are never sorted (already in submission order)
+		for (uint32_t digit = 0; digit < DigitCount; digit++) {
+			auto& histogram = histograms[digit];
+			const uint32_t shift = KeyShift + digit * DigitBits;
+
+			// All keys share this digit, the pass would not change the order
+			if (histogram[(m_Sorted[0] >> shift) & DigitMask] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram) {
+				uint32_t size = bucket;
+				bucket = offset;
+				offset += size;
+			}
+			for (uint64_t key : m_Sorted)
+				m_Scratch[histogram[(key >> shift) & DigitMask]++] = key;
+
+			m_Sorted.swap(m_Scratch);
+			m_Passes++;
+		}
+
+		// One batch per run of equal keys
+		uint64_t runKey = m_Sorted[0] >> KeyShift;
+		uint32_t runBegin = 0;
+		for (uint32_t i = 1; i <= count; i++) {
+			if (i < count && (m_Sorted[i] >> KeyShift) == runKey)
+				continue;
+
+			DrawBatch batch;
+			batch.Pipeline = static_cast<PipelineHandle>(runKey >> 32);
+			batch.Material = static_cast<MaterialHandle>((runKey >> 16) & (MaxDrawMaterials - 1));
+			batch.Mesh = static_cast<MeshHandle>(runKey & (MaxDrawMeshes - 1));
+			batch.FirstInstance = runBegin;
+			batch.InstanceCount = i - runBegin;
+			m_Batches.push_back(batch);
+
+			if (i < count) {
+				runKey = m_Sorted[i] >> KeyShift;
+				runBegin = i;
+			}
+		}
+	}
+
+
+} // namespace Helios::Engine::Renderer
@@ -0,0 +1,146 @@
+//==============================================================================
+// Draw List
+//
+// API-agnostic draw submission. Callers submit batches of mesh instances
+// (pipeline, material and mesh handle plus per-instance data) into a
+// DrawList; the renderer sorts them by a packed 64-bit key with DrawSorter
+// and turns every run of equal keys into one instanced draw. The number of
+// draw commands therefore follows the number of distinct pipeline/material/
+// mesh combinations, not the number of instances.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Submit() appends whole batches, the sort key is built on the way in.
+// - LSD radix sort over the key bits only (8-bit digits), digits shared by
+//   all keys are skipped (a single pipeline costs no pass). The sort is
+//   stable, instances of one draw keep their submission order.
+// - Storage is reused between frames, no allocations once the capacity of
+//   the largest frame has been reached.
+//
+// Notes:
+// - Key layout (high to low): pipeline 8 bit, material 16 bit, mesh 16 bit,
+//   instance index 24 bit. Submit throws above 16M instances per list;
+//   larger handles are truncated (see the Max* constants).
+// - PipelineHandle 0 is the renderer's default pipeline, materials are plain
+//   ids for now (sort key only).
+// - A DrawList belongs to the FramePacket: filled by the main thread, read by
+//   the renderer (see Application::GetDrawList).
+//
+// Usage:
+//   auto& draws = Application::Get().GetDrawList();
+//   draws.Submit(instances.data(), instances.size());
+//
+// Changelog:
+// - 2026.10: DrawStats::CommandBuffers
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <span>
+
+namespace Helios::Engine::Renderer {
+
+
+	using MeshHandle = uint32_t;
+	using MaterialHandle = uint32_t;
+	using PipelineHandle = uint32_t;
+
+	constexpr uint32_t MaxDrawPipelines = 1u << 8;
+	constexpr uint32_t MaxDrawMaterials = 1u << 16;
+	constexpr uint32_t MaxDrawMeshes    = 1u << 16;
+	constexpr uint32_t MaxDrawInstances = 1u << 24;
+
+
+	struct DrawInstance
+	{
+		glm::mat4 Transform = glm::mat4(1.0f);
+		glm::vec4 Color     = glm::vec4(1.0f);
+		MeshHandle Mesh         = 0;
+		MaterialHandle Material = 0;
+		PipelineHandle Pipeline = 0;
+	};
+
+
+	// Geometry for Renderer::CreateMesh
+	struct MeshVertex
+	{
+		glm::vec3 Position;
+		glm::vec3 Color;
+	};
+
+	struct MeshData
+	{
+		std::span<const MeshVertex> Vertices;
+		std::span<const uint32_t> Indices;
+	};
+
+
+	// One instanced draw: instances [FirstInstance, FirstInstance + InstanceCount) of the sorted order
+	struct DrawBatch
+	{
+		PipelineHandle Pipeline = 0;
+		MaterialHandle Material = 0;
+		MeshHandle Mesh = 0;
+		uint32_t FirstInstance = 0;
+		uint32_t InstanceCount = 0;
+	};
+
+
+	// Last frame, see Renderer::GetDrawStats
+	struct DrawStats
+	{
+		uint32_t Instances = 0;
+		uint32_t Batches = 0;      // instanced draws
+		uint32_t DrawCalls = 0;    // draw commands recorded on the CPU (indirect: one per pipeline)
+		uint32_t CommandBuffers = 0; // secondaries recorded in parallel (0 = recorded inline)
+	};
+
+
+	class DrawList
+	{
+	public:
+		void Submit(const DrawInstance* instances, size_t count);
+		void Submit(const DrawInstance& instance) { Submit(&instance, 1); }
+
+		// Keeps the capacity
+		void Clear();
+
+		// --- Accessors ---
+		bool IsEmpty() const { return m_Instances.empty(); }
+		size_t GetInstanceCount() const { return m_Instances.size(); }
+		const std::vector<DrawInstance>& GetInstances() const { return m_Instances; }
+		const std::vector<uint64_t>& GetKeys() const { return m_Keys; } // submission order
+
+		static uint64_t MakeKey(const DrawInstance& instance, uint32_t index);
+
+	private:
+		std::vector<DrawInstance> m_Instances;
+		std::vector<uint64_t> m_Keys;
+	};
+
+
+	class DrawSorter
+	{
+	public:
+		// Sorts the keys of 'list' and builds the batches (replaces the previous result)
+		void Sort(const DrawList& list);
+
+		// --- Accessors ---
+		// Instance indices into DrawList::GetInstances() in draw order
+		uint32_t GetInstanceIndex(size_t drawIndex) const { return static_cast<uint32_t>(m_Sorted[drawIndex] & (MaxDrawInstances - 1)); }
+		const std::vector<DrawBatch>& GetBatches() const { return m_Batches; }
+		uint32_t GetPassCount() const { return m_Passes; } // radix passes of the last sort
+
+	private:
+		std::vector<uint64_t> m_Sorted;
+		std::vector<uint64_t> m_Scratch;
+		std::vector<DrawBatch> m_Batches;
+		uint32_t m_Passes = 0;
+	};
+
+
+} // namespace Helios::Engine::Renderer
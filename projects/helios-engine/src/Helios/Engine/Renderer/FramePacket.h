@@ -0,0 +1,51 @@
+//==============================================================================
+// Frame Packet
+//
+// Holds everything the renderer needs to submit one frame, captured by the
+// main thread after updating: frame index, interpolation factor and a snapshot
+// of the camera matrices and the draw list. The renderer only reads
+// from a packet and never touches live simulation objects, which allows the
+// RenderThread to submit frame N while the main thread updates frame N+1.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Changelog:
+// - 2026.10: Added the DrawList (Draws)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Renderer/Camera.h"
+#include "Helios/Engine/Renderer/DrawList.h"
+
+#include <glm/glm.hpp>
+
+namespace Helios::Engine::Renderer {
+
+
+	struct FramePacket
+	{
+		uint64_t FrameIndex = 0;
+		float Alpha = 1.0f; // Interpolation factor (see Application::GetRenderAlpha)
+
+		// Camera snapshot
+		glm::vec3 CameraPosition = { 0.0f, 0.0f, 0.0f };
+		glm::mat4 View           = glm::mat4(1.0f);
+		glm::mat4 Projection     = glm::mat4(1.0f);
+		glm::mat4 ViewProjection = glm::mat4(1.0f);
+
+		// Instances to draw, cleared by the Application before the layers render
+		DrawList Draws;
+
+		void SetCamera(const Camera& camera)
+		{
+			CameraPosition = camera.GetPosition();
+			View           = camera.GetViewMatrix();
+			Projection     = camera.GetProjectionMatrix();
+			ViewProjection = camera.GetViewProjectionMatrix();
+		}
+	};
+
+
+} // namespace Helios::Engine::Renderer
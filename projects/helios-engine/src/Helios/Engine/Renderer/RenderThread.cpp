@@ -0,0 +1,141 @@
+//==============================================================================
+// Render Thread (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file RenderThread.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/Renderer/RenderThread.h"
+
+namespace Helios::Engine::Renderer {
+
+
+	RenderThread::RenderThread(Renderer& renderer)
+		: m_Renderer(renderer)
+	{
+	}
+
+
+	RenderThread::~RenderThread()
+	{
+		Stop();
+	}
+
+
+	void RenderThread::Start()
+	{
+		if (m_Thread.joinable())
+			return;
+
+		m_Running = true;
+		m_Thread = std::thread(&RenderThread::ThreadMain, this);
+		LOG_RENDER_DEBUG("RenderThread: Started.");
+	}
+
+
+	void RenderThread::Stop()
+	{
+		if (!m_Thread.joinable())
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			m_Running = false;
+		}
+		m_CondVar.notify_all();
+		m_Thread.join();
+
+		// An exception on the render thread during shutdown is only logged
+		if (m_Exception) {
+			try {
+				std::rethrow_exception(m_Exception);
+			}
+			catch (const std::exception& e) {
+				LOG_RENDER_ERROR("RenderThread: Exception during shutdown: {}", e.what());
+			}
+			catch (...) {
+				LOG_RENDER_ERROR("RenderThread: Unknown exception during shutdown.");
+			}
+			m_Exception = nullptr;
+		}
+		LOG_RENDER_DEBUG("RenderThread: Stopped.");
+	}
+
+
+	void RenderThread::Submit()
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			// The previous packet must be finished before its buffer becomes the next write target
+			m_CondVar.wait(lock, [this] { return (!m_Pending && !m_Busy) || m_Exception; });
+			RethrowPendingException();
+
+			m_ReadIndex = m_WriteIndex;
+			m_WriteIndex ^= 1;
+			m_Pending = true;
+		}
+		m_CondVar.notify_all();
+	}
+
+
+	void RenderThread::WaitIdle()
+	{
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_CondVar.wait(lock, [this] { return (!m_Pending && !m_Busy) || m_Exception || !m_Running; });
+		RethrowPendingException();
+	}
+
+
+	void RenderThread::RethrowPendingException()
+	{
+		// Called with m_Mutex held
+		if (m_Exception) {
+			std::exception_ptr e = m_Exception;
+			m_Exception = nullptr;
+			std::rethrow_exception(e);
+		}
+	}
+
+
+	void RenderThread::ThreadMain()
+	{
+		HE_PROFILE_THREAD("Render");
+
+		while (true)
+		{
+			uint32_t index = 0;
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_CondVar.wait(lock, [this] { return m_Pending || !m_Running; });
+				if (!m_Pending)
+					break; // stopped and nothing left to render
+
+				index = m_ReadIndex;
+				m_Pending = false;
+				m_Busy = true;
+			}
+
+			try {
+				HE_PROFILE_SCOPE("RenderFrame");
+				const FramePacket& packet = m_Packets[index];
+				m_Renderer.BeginFrame(packet);
+				m_Renderer.DrawFrame();
+				m_Renderer.EndFrame();
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Exception = std::current_exception();
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Busy = false;
+			}
+			m_CondVar.notify_all();
+		}
+	}
+
+
+} // namespace Helios::Engine::Renderer
@@ -0,0 +1,80 @@
+//==============================================================================
+// Render Thread
+//
+// Runs renderer submission (BeginFrame/DrawFrame/EndFrame) on a dedicated
+// thread so the main thread can update frame N+1 while frame N is recorded
+// and submitted. Uses a double-buffered FramePacket: the main thread fills
+// the write packet and hands it over with Submit(), which blocks only until
+// the render thread has finished the previous packet. Exceptions thrown by
+// the renderer are captured and rethrown on the main thread.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Notes:
+// - Renderer::OnEvent must only be called while the render thread is idle
+//   (see WaitIdle()), the Application takes care of this.
+// - The render thread never touches the window: an out-of-date swapchain is
+//   only flagged there, the Application recreates it on the main thread
+//   after WaitIdle() (Renderer::RecreateSwapchain).
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Renderer/Renderer.h"
+#include "Helios/Engine/Renderer/FramePacket.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace Helios::Engine::Renderer {
+
+
+	class RenderThread
+	{
+	public:
+		RenderThread(Renderer& renderer);
+		~RenderThread();
+
+		// Prevent copying and moving
+		RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+
+		void Start();
+		void Stop();
+
+		// Packet owned by the main thread until the next Submit()
+		FramePacket& GetWritePacket() { return m_Packets[m_WriteIndex]; }
+
+		// Hand the write packet over to the render thread and swap buffers
+		void Submit();
+
+		// Block until the render thread has no pending or active frame
+		void WaitIdle();
+
+	private:
+		void ThreadMain();
+		void RethrowPendingException();
+
+	private:
+		Renderer& m_Renderer;
+
+		std::array<FramePacket, 2> m_Packets;
+		uint32_t m_WriteIndex = 0;
+		uint32_t m_ReadIndex = 0;
+
+		std::thread m_Thread;
+		std::mutex m_Mutex;
+		std::condition_variable m_CondVar;
+		bool m_Running = false;
+		bool m_Pending = false; // packet submitted but not yet picked up
+		bool m_Busy = false;    // render thread is working on a packet
+		std::exception_ptr m_Exception;
+	};
+
+
+} // namespace Helios::Engine::Renderer
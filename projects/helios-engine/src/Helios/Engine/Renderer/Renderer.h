@@ -18,8 +18,15 @@
 //   renderer's state and resources.
 // - Extensible Design: Structured to accommodate future rendering commands
 //   like `BeginFrame`, `Draw`, and `EndFrame`.
+// - Draw Submission: instances come with the FramePacket (DrawList), meshes
+//   live in a renderer owned pool (`CreateMesh`).
 // 
 // Changelog:
+// - 2026.10: IsSwapchainOutOfDate/RecreateSwapchain, swapchain recreation moved to the main thread
+// - 2026.10: Draw submission through FramePacket::Draws, CreateMesh, GetDrawStats
+// - 2026.10: Headless mode (Init without window), ReadbackFrame, GetGpuFrameTime
+// - 2026.10: Added GetFramesInFlight
+// - 2026.10: BeginFrame takes a FramePacket (camera snapshot) instead of a Camera
 // - 2026.01: Introduced Camera to BeginFrame
 // - 2026.01: Refactored rendering loop into BeginFrame/EndFrame
 // - 2026.01: Initial version / start of version history
@@ -29,6 +36,8 @@
 #include "Helios/Engine/Core/Application.h"
 #include "Helios/Engine/Renderer/Window.h"
 #include "Helios/Engine/Renderer/Camera.h"
+#include "Helios/Engine/Renderer/FramePacket.h"
+#include "Helios/Engine/Renderer/DrawList.h"
 
 namespace Helios::Engine::Renderer {
 
@@ -39,17 +48,37 @@ namespace Helios::Engine::Renderer {
 		static Scope<Renderer> Create();
 		virtual ~Renderer() = default;
 
-		virtual void Init(const AppSpec& appSpec, Window& window) = 0;
+		// window == nullptr: headless, render into offscreen images (AppSpec::Headless)
+		virtual void Init(const AppSpec& appSpec, Window* window) = 0;
 		virtual void Shutdown() = 0;
 
 		virtual void OnEvent(Event& e) = 0;
 		
-		virtual bool BeginFrame(Camera& camera) = 0;
+		virtual bool BeginFrame(const FramePacket& packet) = 0;
 		virtual void EndFrame() = 0;
+		// Records the instances of the packet's DrawList (sorted, instanced)
 		virtual void DrawFrame() = 0;
 
-		// Other methods for rendering will go here later
-		// virtual void Draw() = 0;
+		// Geometry for DrawInstance::Mesh, thread-safe (uploaded with the next frame).
+		// Mesh 0 is a built-in test triangle (temporary)
+		virtual MeshHandle CreateMesh(const MeshData& mesh) = 0;
+
+		// Number of frames the CPU may be ahead of the GPU
+		virtual uint32_t GetFramesInFlight() const = 0;
+
+		// GPU time of the last completed frame in milliseconds (0 if unsupported)
+		virtual double GetGpuFrameTime() const = 0;
+
+		// Copy the last rendered frame to the CPU as RGBA8 (headless only, waits for the GPU)
+		virtual bool ReadbackFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) = 0;
+
+		// Instances and draw commands of the last recorded frame
+		virtual DrawStats GetDrawStats() const = 0;
+
+		// Set when acquire or present reported an out-of-date swapchain, BeginFrame skips frames until
+		// RecreateSwapchain() ran. RecreateSwapchain queries the window: main thread only, render thread idle
+		virtual bool IsSwapchainOutOfDate() const = 0;
+		virtual void RecreateSwapchain() = 0;
 	};
 
 
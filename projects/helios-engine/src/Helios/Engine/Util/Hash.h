@@ -0,0 +1,60 @@
+//==============================================================================
+// Hashing Utilities
+//
+// Small, stable (platform and run independent) 64-bit hashes for content
+// keys and cache validation. Not suitable for security purposes.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Main Features:
+// - FNV-1a 64-bit over raw bytes, strings and byte vectors (chainable via seed)
+// - HashCombine for building keys from several values
+// 
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Helios::Util {
+
+
+	constexpr uint64_t FNV1A_OFFSET_BASIS = 14695981039346656037ull;
+	constexpr uint64_t FNV1A_PRIME = 1099511628211ull;
+
+
+	inline uint64_t HashFnv1a(const void* data, size_t size, uint64_t seed = FNV1A_OFFSET_BASIS)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		uint64_t hash = seed;
+		for (size_t i = 0; i < size; ++i)
+			hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+		return hash;
+	}
+
+
+	inline uint64_t HashFnv1a(std::string_view text, uint64_t seed = FNV1A_OFFSET_BASIS)
+	{
+		return HashFnv1a(text.data(), text.size(), seed);
+	}
+
+
+	inline uint64_t HashFnv1a(const std::vector<uint8_t>& data, uint64_t seed = FNV1A_OFFSET_BASIS)
+	{
+		return HashFnv1a(data.data(), data.size(), seed);
+	}
+
+
+	// Mixes value into seed (boost::hash_combine, 64-bit constant)
+	inline uint64_t HashCombine(uint64_t seed, uint64_t value)
+	{
+		return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+	}
+
+
+} // namespace Helios::Util
@@ -0,0 +1,104 @@
+//==============================================================================
+// VFS File Watcher (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Further information in the corresponding header file FileWatcher.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Engine/VFS/FileWatcher.h"
+
+#include "Helios/Engine/VFS/VFS.h"
+
+namespace Helios::Engine::VFS {
+
+
+	FileWatcher::FileWatcher(double intervalSeconds)
+	{
+		SetInterval(intervalSeconds);
+	}
+
+
+	void FileWatcher::SetInterval(double seconds)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_IntervalTicks = Clock::SecondsToTicks(std::max(seconds, 0.0));
+	}
+
+
+	void FileWatcher::Snapshot(Entry& entry)
+	{
+		// Exists first, GetFileHandle warns about missing files
+		entry.Exists = VirtFS.Exists(entry.Path);
+		if (!entry.Exists) {
+			entry.Size = 0;
+			entry.LastWriteTime = 0;
+			return;
+		}
+
+		FileHandle handle = VirtFS.GetFileHandle(entry.Path);
+		entry.Size = handle.Size;
+		entry.LastWriteTime = handle.LastWriteTime;
+	}
+
+
+	void FileWatcher::Watch(const std::string& virtualPath, Callback callback)
+	{
+		Entry entry;
+		entry.Path = virtualPath;
+		entry.OnChange = std::move(callback);
+		Snapshot(entry);
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Entries.push_back(std::move(entry));
+		LOG_CORE_DEBUG("FileWatcher: Watching '{}'.", virtualPath);
+	}
+
+
+	void FileWatcher::Unwatch(const std::string& virtualPath)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(),
+			[&virtualPath](const Entry& entry) { return entry.Path == virtualPath; }), m_Entries.end());
+	}
+
+
+	uint32_t FileWatcher::Poll()
+	{
+		uint64_t now = Clock::Now();
+
+		std::vector<std::pair<std::string, Callback>> changed;
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+			if (now < m_NextPoll)
+				return 0;
+			m_NextPoll = now + m_IntervalTicks;
+
+			HE_PROFILE_SCOPE("FileWatcher::Poll");
+			for (auto& entry : m_Entries)
+			{
+				Entry current;
+				current.Path = entry.Path;
+				Snapshot(current);
+				if (current.Exists == entry.Exists && current.Size == entry.Size && current.LastWriteTime == entry.LastWriteTime)
+					continue;
+
+				entry.Exists = current.Exists;
+				entry.Size = current.Size;
+				entry.LastWriteTime = current.LastWriteTime;
+				changed.emplace_back(entry.Path, entry.OnChange);
+			}
+		}
+
+		// Outside the lock, callbacks may (un)watch files
+		for (auto& [path, callback] : changed) {
+			LOG_CORE_DEBUG("FileWatcher: '{}' changed.", path);
+			if (callback)
+				callback(path);
+		}
+		return static_cast<uint32_t>(changed.size());
+	}
+
+
+} // namespace Helios::Engine::VFS
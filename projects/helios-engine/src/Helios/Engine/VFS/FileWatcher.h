@@ -0,0 +1,65 @@
+//==============================================================================
+// VFS File Watcher
+//
+// Detects changes of files addressed through the VFS (aliases and mount
+// points are resolved on every check, so an overlay mounted later is picked
+// up as well). Polling based: Poll() compares last write time and size of the
+// watched files at most once per interval and calls the callbacks of changed
+// files on the polling thread. Meant for development features such as shader
+// or config hot reload, not for large numbers of files.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Watch/Unwatch virtual paths with a callback each
+// - Throttled polling (default 0.5 s), cheap to call every frame
+// - Reports created, modified and deleted files
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Helios::Engine::VFS {
+
+
+	class FileWatcher
+	{
+	public:
+		using Callback = std::function<void(const std::string& virtualPath)>;
+
+		explicit FileWatcher(double intervalSeconds = 0.5);
+
+		void Watch(const std::string& virtualPath, Callback callback);
+		void Unwatch(const std::string& virtualPath);
+		void SetInterval(double seconds);
+
+		// Checks the watched files if the interval elapsed, returns the number of changed files
+		uint32_t Poll();
+
+	private:
+		struct Entry {
+			std::string Path;
+			Callback OnChange;
+			bool Exists = false;
+			size_t Size = 0;
+			uint64_t LastWriteTime = 0;
+		};
+
+		static void Snapshot(Entry& entry);
+
+	private:
+		std::mutex m_Mutex;
+		std::vector<Entry> m_Entries;
+		uint64_t m_IntervalTicks = 0;
+		uint64_t m_NextPoll = 0;
+	};
+
+
+} // namespace Helios::Engine::VFS
@@ -10,6 +10,7 @@
 #include "Helios/Engine/VFS/VFS.h"
 
 #include "Helios/Engine/VFS/VFS_PhysFS.h"
+#include "Helios/Engine/Core/JobSystem.h"
 
 #include <algorithm>
 #include <sstream>
@@ -47,6 +48,9 @@ namespace Helios::Engine::VFS {
 
 	bool VirtualFileSystem::Mount(const std::string& virtualPath, Scope<VFSBackend> backend, int priority, const std::string& id, bool readOnly)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("VFS");
+
 		std::lock_guard<std::mutex> lock(m_Mutex);
 
 		std::string normalizedPath = NormalizePath(virtualPath);
@@ -281,6 +285,9 @@ namespace Helios::Engine::VFS {
 
 	Scope<FileStream> VirtualFileSystem::OpenStream(const std::string& virtualPath, FileMode mode)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("VFS");
+
 		std::lock_guard<std::mutex> lock(m_Mutex);
 
 		std::string resolvedPath = ResolvePath(virtualPath);
@@ -332,6 +339,9 @@ namespace Helios::Engine::VFS {
 
 	std::vector<uint8_t> VirtualFileSystem::ReadBinary(const std::string& virtualPath)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("VFS");
+
 		auto stream = OpenStream(virtualPath, FileMode::Read);
 		if (!stream || !stream->IsValid()) {
 			LOG_CORE_ERROR("VFS: Failed to open file '{}'", virtualPath);
@@ -354,17 +364,42 @@ namespace Helios::Engine::VFS {
 
 	std::string VirtualFileSystem::ReadText(const std::string& virtualPath)
 	{
+		HE_MEMORY_TAG("VFS");
 		auto data = ReadBinary(virtualPath);
 		return std::string(data.begin(), data.end());
 	}
 
 
+	void VirtualFileSystem::ReadBinaryAsync(const std::string& virtualPath, std::function<void(std::vector<uint8_t>)> callback, JobCounter* counter)
+	{
+		auto job = [this, virtualPath, callback = std::move(callback)] {
+			callback(ReadBinary(virtualPath));
+		};
+
+		if (JobSystem* jobs = JobSystem::Get())
+			jobs->Run(std::move(job), counter);
+		else
+			job();
+	}
+
+
+	void VirtualFileSystem::ReadTextAsync(const std::string& virtualPath, std::function<void(std::string)> callback, JobCounter* counter)
+	{
+		ReadBinaryAsync(virtualPath, [callback = std::move(callback)](std::vector<uint8_t> data) {
+			callback(std::string(data.begin(), data.end()));
+		}, counter);
+	}
+
+
 	//------------------------------------------------------------------------------
 	// Write operations
 	//------------------------------------------------------------------------------
 
 	bool VirtualFileSystem::WriteBinary(const std::string& virtualPath, const std::vector<uint8_t>& data)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("VFS");
+
 		auto stream = OpenStream(virtualPath, FileMode::Write);
 		if (!stream || !stream->IsValid()) {
 			LOG_CORE_ERROR("VFS: Failed to open file '{}' for writing", virtualPath);
@@ -391,6 +426,9 @@ namespace Helios::Engine::VFS {
 
 	std::vector<std::string> VirtualFileSystem::ListFiles(const std::string& virtualPath, bool recursive) const
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("VFS");
+
 		std::lock_guard<std::mutex> lock(m_Mutex);
 
 		std::string resolvedPath = ResolvePath(virtualPath);
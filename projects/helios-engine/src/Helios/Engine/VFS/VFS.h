@@ -15,9 +15,13 @@
 // - Backend abstraction (filesystem/archives)
 // - Thread-safe with LRU cache
 // - Stream-based I/O
+// - Asynchronous reads on the JobSystem
 // - Directory management 
 // 
 // Changelog:
+// - 2026.10: FileHandle carries the last write time (change detection, FileWatcher)
+// - 2026.10: Allocations accounted to memory tag "VFS"
+// - 2026.10: Added asynchronous reads via the JobSystem
 // - 2026.01: Added file read/write stream abstraction
 // - 2026.01: Switched to 'Meyer's Singleton' pattern
 //            Added directory creation support
@@ -30,6 +34,7 @@
 
 #include "Helios/Engine/Util/ScopeRef.h"
 
+#include <functional>
 #include <list>
 #include <map>
 #include <mutex>
@@ -40,6 +45,10 @@
 // Singleton access macro
 #define VirtFS Helios::Engine::VFS::VirtualFileSystem::GetInstance()
 
+namespace Helios::Engine {
+	class JobCounter;
+}
+
 namespace Helios::Engine::VFS {
 
 
@@ -61,6 +70,7 @@ namespace Helios::Engine::VFS {
 		std::string VirtualPath;
 		std::string PhysicalPath;
 		size_t Size = 0;
+		uint64_t LastWriteTime = 0; // backend specific, only compared for equality (0 = unknown)
 		bool Valid = false;
 	};
 
@@ -175,6 +185,11 @@ namespace Helios::Engine::VFS {
 		std::vector<uint8_t> ReadBinary(const std::string& virtualPath);
 		std::string ReadText(const std::string& virtualPath);
 
+		// Asynchronous read on a JobSystem worker (runs synchronously if no JobSystem exists).
+		// The callback is invoked on the worker thread, an empty buffer signals failure.
+		void ReadBinaryAsync(const std::string& virtualPath, std::function<void(std::vector<uint8_t>)> callback, JobCounter* counter = nullptr);
+		void ReadTextAsync(const std::string& virtualPath, std::function<void(std::string)> callback, JobCounter* counter = nullptr);
+
 		// Write...
 		bool WriteBinary(const std::string& virtualPath, const std::vector<uint8_t>& data);
 		bool WriteText(const std::string& virtualPath, const std::string& text);
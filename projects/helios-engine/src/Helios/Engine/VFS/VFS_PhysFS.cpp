@@ -61,6 +61,7 @@ namespace Helios::Engine::VFS {
 		try {
 			if (fs::exists(handle.PhysicalPath) && !fs::is_directory(handle.PhysicalPath)) {
 				handle.Size = static_cast<size_t>(fs::file_size(handle.PhysicalPath));
+				handle.LastWriteTime = static_cast<uint64_t>(fs::last_write_time(handle.PhysicalPath).time_since_epoch().count());
 				handle.Valid = true;
 			}
 		} catch (const fs::filesystem_error& e) {
@@ -18,6 +18,7 @@
 // - Automatic resource management and error handling
 // 
 // Changelog:
+// - 2026.10: File handles report the last write time
 // - 2026.01: Fixed file not exists on write stream open
 // - 2026.01: Added directory creation support
 // - 2026.01: Initial version / start of version history
@@ -0,0 +1,234 @@
+//==============================================================================
+// Vulkan Bindless Descriptor Heap (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKBindlessHeap.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKBindlessHeap.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+#include "Helios/Engine/Core/Config.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	namespace {
+
+		constexpr std::array<vk::DescriptorType, static_cast<size_t>(BindlessType::Count)> DescriptorTypes = {
+			vk::DescriptorType::eStorageBuffer,
+			vk::DescriptorType::eSampledImage,
+			vk::DescriptorType::eSampler,
+		};
+
+		constexpr std::array<const char*, static_cast<size_t>(BindlessType::Count)> TypeNames = {
+			"StorageBuffers",
+			"SampledImages",
+			"Samplers",
+		};
+
+	} // anonymous namespace
+
+
+	VKBindlessHeap::VKBindlessHeap(const VKDeviceManager& deviceManager, uint32_t framesInFlight)
+		: m_deviceManager(deviceManager)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		// Capacities are limited by the update-after-bind limits (set and per stage)
+		auto chain = m_deviceManager.GetPhysicalDevice().getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceDescriptorIndexingProperties>();
+		const auto& limits = chain.get<vk::PhysicalDeviceDescriptorIndexingProperties>();
+		const std::array<uint32_t, static_cast<size_t>(BindlessType::Count)> deviceLimits = {
+			std::min(limits.maxDescriptorSetUpdateAfterBindStorageBuffers, limits.maxPerStageDescriptorUpdateAfterBindStorageBuffers),
+			std::min(limits.maxDescriptorSetUpdateAfterBindSampledImages, limits.maxPerStageDescriptorUpdateAfterBindSampledImages),
+			std::min(limits.maxDescriptorSetUpdateAfterBindSamplers, limits.maxPerStageDescriptorUpdateAfterBindSamplers),
+		};
+		const std::array<int, static_cast<size_t>(BindlessType::Count)> defaults = { 16384, 16384, 256 };
+
+		// Shared per-stage budget for all bindings together
+		uint32_t resourcesLeft = limits.maxPerStageUpdateAfterBindResources;
+
+		std::vector<vk::DescriptorSetLayoutBinding> bindings;
+		std::vector<vk::DescriptorBindingFlags> bindingFlags;
+		std::vector<vk::DescriptorPoolSize> poolSizes;
+		for (uint32_t i = 0; i < static_cast<uint32_t>(BindlessType::Count); i++) {
+			int configured = ConfigManager::GetInstance().Get<int>("renderer_vulkan", "Bindless", TypeNames[i], defaults[i]);
+			uint32_t capacity = std::min({ static_cast<uint32_t>(std::max(configured, 1)), deviceLimits[i], resourcesLeft });
+			resourcesLeft -= capacity;
+			m_slots[i].Capacity = capacity;
+
+			// A zero-count binding would need a zero-sized pool entry, the type is left out instead
+			// (its Add* calls throw like a full heap)
+			if (capacity == 0) {
+				LOG_RENDER_WARN("VKBindlessHeap: No {} slots left by the device limits, binding {} skipped.", TypeNames[i], i);
+				continue;
+			}
+
+			bindings.push_back(vk::DescriptorSetLayoutBinding()
+				.setBinding(i)
+				.setDescriptorType(DescriptorTypes[i])
+				.setDescriptorCount(capacity)
+				.setStageFlags(vk::ShaderStageFlagBits::eAll));
+			bindingFlags.push_back(vk::DescriptorBindingFlagBits::ePartiallyBound | vk::DescriptorBindingFlagBits::eUpdateAfterBind |
+				vk::DescriptorBindingFlagBits::eUpdateUnusedWhilePending);
+			poolSizes.push_back(vk::DescriptorPoolSize(DescriptorTypes[i], capacity));
+		}
+
+		if (bindings.empty())
+			LOG_RENDER_EXCEPT("VKBindlessHeap: The device limits leave no descriptor for any binding.");
+
+		vk::DescriptorSetLayoutBindingFlagsCreateInfo flagsInfo = vk::DescriptorSetLayoutBindingFlagsCreateInfo()
+			.setBindingFlags(bindingFlags);
+		vk::DescriptorSetLayoutCreateInfo layoutInfo = vk::DescriptorSetLayoutCreateInfo()
+			.setFlags(vk::DescriptorSetLayoutCreateFlagBits::eUpdateAfterBindPool)
+			.setBindings(bindings)
+			.setPNext(&flagsInfo);
+		m_layout = logicalDevice.createDescriptorSetLayout(layoutInfo);
+
+		vk::DescriptorPoolCreateInfo poolInfo = vk::DescriptorPoolCreateInfo()
+			.setFlags(vk::DescriptorPoolCreateFlagBits::eUpdateAfterBind)
+			.setMaxSets(1)
+			.setPoolSizes(poolSizes);
+		m_pool = logicalDevice.createDescriptorPool(poolInfo);
+
+		vk::DescriptorSetAllocateInfo allocInfo = vk::DescriptorSetAllocateInfo()
+			.setDescriptorPool(m_pool)
+			.setDescriptorSetCount(1)
+			.setPSetLayouts(&m_layout);
+		m_set = logicalDevice.allocateDescriptorSets(allocInfo)[0];
+
+		m_pendingRemoval.resize(std::max(framesInFlight, 1u));
+
+		LOG_RENDER_DEBUG("VKBindlessHeap: Created ({} storage buffers, {} sampled images, {} samplers).",
+			m_slots[0].Capacity, m_slots[1].Capacity, m_slots[2].Capacity);
+	}
+
+
+	VKBindlessHeap::~VKBindlessHeap()
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		if (m_pool)
+			logicalDevice.destroyDescriptorPool(m_pool); // frees m_set
+		if (m_layout)
+			logicalDevice.destroyDescriptorSetLayout(m_layout);
+		LOG_RENDER_DEBUG("VKBindlessHeap: Destroyed.");
+	}
+
+
+	BindlessIndex VKBindlessHeap::AddStorageBuffer(vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range)
+	{
+		BindlessIndex index = AllocateSlot(BindlessType::StorageBuffer);
+		vk::DescriptorBufferInfo bufferInfo(buffer, offset, range);
+		Write(BindlessType::StorageBuffer, index, &bufferInfo, nullptr);
+		return index;
+	}
+
+
+	BindlessIndex VKBindlessHeap::AddSampledImage(vk::ImageView imageView, vk::ImageLayout layout)
+	{
+		BindlessIndex index = AllocateSlot(BindlessType::SampledImage);
+		vk::DescriptorImageInfo imageInfo(nullptr, imageView, layout);
+		Write(BindlessType::SampledImage, index, nullptr, &imageInfo);
+		return index;
+	}
+
+
+	BindlessIndex VKBindlessHeap::AddSampler(vk::Sampler sampler)
+	{
+		BindlessIndex index = AllocateSlot(BindlessType::Sampler);
+		vk::DescriptorImageInfo imageInfo(sampler, nullptr, vk::ImageLayout::eUndefined);
+		Write(BindlessType::Sampler, index, nullptr, &imageInfo);
+		return index;
+	}
+
+
+	void VKBindlessHeap::UpdateStorageBuffer(BindlessIndex index, vk::Buffer buffer, vk::DeviceSize offset, vk::DeviceSize range)
+	{
+		vk::DescriptorBufferInfo bufferInfo(buffer, offset, range);
+		Write(BindlessType::StorageBuffer, index, &bufferInfo, nullptr);
+	}
+
+
+	BindlessIndex VKBindlessHeap::AllocateSlot(BindlessType type)
+	{
+		std::lock_guard lock(m_mutex);
+		SlotTable& table = m_slots[static_cast<uint32_t>(type)];
+
+		BindlessIndex index = InvalidBindlessIndex;
+		if (!table.FreeList.empty()) {
+			index = table.FreeList.back();
+			table.FreeList.pop_back();
+		}
+		else if (table.Next < table.Capacity) {
+			index = table.Next++;
+		}
+		else {
+			LOG_RENDER_EXCEPT("VKBindlessHeap: No free {} slot (capacity {}), see renderer_vulkan/Bindless/{}.",
+				TypeNames[static_cast<uint32_t>(type)], table.Capacity, TypeNames[static_cast<uint32_t>(type)]);
+		}
+
+		table.Used++;
+		return index;
+	}
+
+
+	void VKBindlessHeap::Write(BindlessType type, BindlessIndex index, const vk::DescriptorBufferInfo* bufferInfo, const vk::DescriptorImageInfo* imageInfo)
+	{
+		vk::WriteDescriptorSet write = vk::WriteDescriptorSet()
+			.setDstSet(m_set)
+			.setDstBinding(static_cast<uint32_t>(type))
+			.setDstArrayElement(index)
+			.setDescriptorCount(1)
+			.setDescriptorType(DescriptorTypes[static_cast<uint32_t>(type)])
+			.setPBufferInfo(bufferInfo)
+			.setPImageInfo(imageInfo);
+
+		// Different slots may be written from several threads, the set itself needs external sync
+		std::lock_guard lock(m_mutex);
+		m_deviceManager.GetLogicalDevice().updateDescriptorSets({ write }, {});
+	}
+
+
+	void VKBindlessHeap::Remove(BindlessType type, BindlessIndex index)
+	{
+		if (index == InvalidBindlessIndex)
+			return;
+
+		std::lock_guard lock(m_mutex);
+		m_pendingRemoval[m_currentFrame].emplace_back(type, index);
+	}
+
+
+	void VKBindlessHeap::BeginFrame(uint32_t frame)
+	{
+		std::lock_guard lock(m_mutex);
+		m_currentFrame = frame % static_cast<uint32_t>(m_pendingRemoval.size());
+
+		// Removed while this frame was recorded last time, its fence has signaled since
+		auto& removed = m_pendingRemoval[m_currentFrame];
+		for (const auto& [type, index] : removed) {
+			SlotTable& table = m_slots[static_cast<uint32_t>(type)];
+			table.FreeList.push_back(index);
+			table.Used--;
+		}
+		removed.clear();
+	}
+
+
+	void VKBindlessHeap::Bind(vk::CommandBuffer commandBuffer, vk::PipelineLayout pipelineLayout, vk::PipelineBindPoint bindPoint, uint32_t set) const
+	{
+		commandBuffer.bindDescriptorSets(bindPoint, pipelineLayout, set, { m_set }, {});
+	}
+
+
+	uint32_t VKBindlessHeap::GetUsedCount(BindlessType type) const
+	{
+		std::lock_guard lock(m_mutex);
+		return m_slots[static_cast<uint32_t>(type)].Used;
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,119 @@
+//==============================================================================
+// Vulkan Bindless Descriptor Heap
+//
+// One global descriptor set with large runtime arrays of storage buffers,
+// sampled images and samplers (descriptor indexing, core in Vulkan 1.2 or
+// VK_EXT_descriptor_indexing). Resources are registered once and get a slot
+// index; draws pass indices (push constants, instance data) instead of
+// binding descriptor sets per material.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Update-after-bind, partially bound bindings: slots can be written while
+//   the set is bound by command buffers in flight.
+// - Free-list slot allocation per resource type.
+// - Deferred slot reuse: a removed slot is recycled only after the fence of
+//   the frame that removed it has signaled (BeginFrame).
+// - Capacities from renderer_vulkan/Bindless/*, clamped to device limits
+//   (a type without any slot left gets no binding).
+//
+// Notes:
+// - Matching GLSL declarations (set = 0):
+//     layout(set = 0, binding = 0) buffer StorageBuffers { uint data[]; } u_Buffers[];
+//     layout(set = 0, binding = 1) uniform texture2D u_Textures[];
+//     layout(set = 0, binding = 2) uniform sampler u_Samplers[];
+//   Use nonuniformEXT() for indices that differ within a draw.
+// - Only created when the device supports descriptor indexing
+//   (VKDeviceManager::GetFeatures().descriptorIndexing).
+// - A pipeline that reads the heap adds GetLayout() with
+//   VKPipelineBuilder::SetDescriptorSetLayouts and calls Bind before its draws;
+//   the renderer's simple pipeline declares no descriptor sets and does neither.
+//
+// Changelog:
+// - 2026.10: Types clamped to zero slots are skipped instead of creating an empty binding
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	enum class BindlessType : uint32_t
+	{
+		StorageBuffer = 0, // binding 0
+		SampledImage,      // binding 1
+		Sampler,           // binding 2
+		Count
+	};
+
+	using BindlessIndex = uint32_t;
+	constexpr BindlessIndex InvalidBindlessIndex = UINT32_MAX;
+
+
+	class VKBindlessHeap
+	{
+	public:
+		VKBindlessHeap(const VKDeviceManager& deviceManager, uint32_t framesInFlight);
+		~VKBindlessHeap();
+
+		// Prevent copying and moving
+		VKBindlessHeap(const VKBindlessHeap&) = delete;
+		VKBindlessHeap& operator=(const VKBindlessHeap&) = delete;
+		VKBindlessHeap(VKBindlessHeap&&) = delete;
+		VKBindlessHeap& operator=(VKBindlessHeap&&) = delete;
+
+		// Register a resource, returns its slot (throws when the heap is full)
+		BindlessIndex AddStorageBuffer(vk::Buffer buffer, vk::DeviceSize offset = 0, vk::DeviceSize range = VK_WHOLE_SIZE);
+		BindlessIndex AddSampledImage(vk::ImageView imageView, vk::ImageLayout layout = vk::ImageLayout::eShaderReadOnlyOptimal);
+		BindlessIndex AddSampler(vk::Sampler sampler);
+
+		// Point an existing slot to another resource (e.g. after a resize)
+		void UpdateStorageBuffer(BindlessIndex index, vk::Buffer buffer, vk::DeviceSize offset = 0, vk::DeviceSize range = VK_WHOLE_SIZE);
+
+		// The slot is reused once the current frame has finished on the GPU
+		void Remove(BindlessType type, BindlessIndex index);
+
+		// Call after the fence of 'frame' was waited for, recycles the slots removed while it was recorded
+		void BeginFrame(uint32_t frame);
+
+		void Bind(vk::CommandBuffer commandBuffer, vk::PipelineLayout pipelineLayout, vk::PipelineBindPoint bindPoint = vk::PipelineBindPoint::eGraphics, uint32_t set = 0) const;
+
+		// --- Accessors ---
+		vk::DescriptorSetLayout GetLayout() const { return m_layout; }
+		vk::DescriptorSet GetSet() const { return m_set; }
+		uint32_t GetCapacity(BindlessType type) const { return m_slots[static_cast<uint32_t>(type)].Capacity; }
+		uint32_t GetUsedCount(BindlessType type) const;
+
+	private:
+		struct SlotTable
+		{
+			uint32_t Capacity = 0;
+			uint32_t Next = 0;              // slots below were handed out at least once
+			uint32_t Used = 0;
+			std::vector<BindlessIndex> FreeList;
+		};
+
+		BindlessIndex AllocateSlot(BindlessType type);
+		void Write(BindlessType type, BindlessIndex index, const vk::DescriptorBufferInfo* bufferInfo, const vk::DescriptorImageInfo* imageInfo);
+
+	private:
+		std::array<SlotTable, static_cast<size_t>(BindlessType::Count)> m_slots;
+		std::vector<std::vector<std::pair<BindlessType, BindlessIndex>>> m_pendingRemoval; // per frame in flight
+		uint32_t m_currentFrame = 0;
+		mutable std::mutex m_mutex;
+
+		vk::DescriptorSetLayout m_layout = nullptr;
+		vk::DescriptorPool m_pool = nullptr;
+		vk::DescriptorSet m_set = nullptr;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,90 @@
+//==============================================================================
+// Vulkan Buffer Wrapper (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKBuffer.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKBuffer.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	namespace {
+
+		vk::BufferUsageFlags GetUsageFlags(BufferType type)
+		{
+			switch (type) {
+				case BufferType::Vertex:  return vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eTransferDst;
+				case BufferType::Index:   return vk::BufferUsageFlagBits::eIndexBuffer | vk::BufferUsageFlagBits::eTransferDst;
+				case BufferType::Uniform: return vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eTransferDst;
+				case BufferType::Storage: return vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eTransferDst;
+				case BufferType::Staging: return vk::BufferUsageFlagBits::eTransferSrc;
+			}
+			return {};
+		}
+
+	} // anonymous namespace
+
+
+	VKBuffer::VKBuffer(const VKDeviceManager& deviceManager, BufferType type, vk::DeviceSize size, MemoryUsage usage, vk::BufferUsageFlags extraUsage)
+		: m_type(type), m_size(size), m_deviceManager(deviceManager)
+	{
+		vk::BufferCreateInfo bufferInfo = vk::BufferCreateInfo()
+			.setSize(size)
+			.setUsage(GetUsageFlags(type) | extraUsage)
+			.setSharingMode(vk::SharingMode::eExclusive);
+		m_buffer = m_deviceManager.GetLogicalDevice().createBuffer(bufferInfo);
+
+		try {
+			m_memory = m_deviceManager.GetMemoryAllocator().AllocateForBuffer(m_buffer, { usage });
+		}
+		catch (...) {
+			m_deviceManager.GetLogicalDevice().destroyBuffer(m_buffer);
+			throw;
+		}
+	}
+
+
+	VKBuffer::~VKBuffer()
+	{
+		if (m_buffer) {
+			m_deviceManager.GetLogicalDevice().destroyBuffer(m_buffer);
+			m_deviceManager.GetMemoryAllocator().Free(m_memory);
+			m_buffer = nullptr;
+		}
+	}
+
+
+	void VKBuffer::Write(const void* data, vk::DeviceSize size, vk::DeviceSize offset)
+	{
+		if (!m_memory.Mapped) {
+			LOG_RENDER_EXCEPT("VKBuffer: Write to a buffer that is not host visible, use the VKUploadManager.");
+		}
+		if (offset + size > m_size) {
+			LOG_RENDER_EXCEPT("VKBuffer: Write of {} bytes at offset {} exceeds the buffer size {}.", size, offset, m_size);
+		}
+
+		std::memcpy(static_cast<uint8_t*>(m_memory.Mapped) + offset, data, static_cast<size_t>(size));
+		m_deviceManager.GetMemoryAllocator().Flush(m_memory, offset, size);
+	}
+
+
+	vk::AccessFlags VKBuffer::GetReadAccess(BufferType type)
+	{
+		switch (type) {
+			case BufferType::Vertex:  return vk::AccessFlagBits::eVertexAttributeRead;
+			case BufferType::Index:   return vk::AccessFlagBits::eIndexRead;
+			case BufferType::Uniform: return vk::AccessFlagBits::eUniformRead;
+			case BufferType::Storage: return vk::AccessFlagBits::eShaderRead;
+			case BufferType::Staging: return vk::AccessFlagBits::eTransferRead;
+		}
+		return {};
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
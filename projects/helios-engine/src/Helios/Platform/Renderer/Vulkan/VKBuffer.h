@@ -0,0 +1,80 @@
+//==============================================================================
+// Vulkan Buffer Wrapper
+//
+// Encapsulates a vk::Buffer together with its memory from the
+// VKMemoryAllocator. The buffer type selects the usage flags; device local
+// buffers are filled through the VKUploadManager, host visible ones can be
+// written directly.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Vertex, index, uniform, storage and staging buffers.
+// - Memory placement by MemoryUsage (GpuOnly buffers are transfer targets).
+// - Write() for mapped buffers (flushes non-coherent memory).
+//
+// Notes:
+// - The buffer must not be in use by the GPU when it is destroyed.
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Platform/Renderer/Vulkan/VKMemoryAllocator.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	enum class BufferType
+	{
+		Vertex,
+		Index,
+		Uniform,
+		Storage,
+		Staging
+	};
+
+
+	class VKBuffer
+	{
+	public:
+		VKBuffer(const VKDeviceManager& deviceManager, BufferType type, vk::DeviceSize size, MemoryUsage usage = MemoryUsage::GpuOnly, vk::BufferUsageFlags extraUsage = {});
+		~VKBuffer();
+
+		// Prevent copying and moving
+		VKBuffer(const VKBuffer&) = delete;
+		VKBuffer& operator=(const VKBuffer&) = delete;
+		VKBuffer(VKBuffer&&) = delete;
+		VKBuffer& operator=(VKBuffer&&) = delete;
+
+		// Host visible buffers only
+		void Write(const void* data, vk::DeviceSize size, vk::DeviceSize offset = 0);
+
+		// Access a shader stage performs on this type of buffer (used for upload barriers)
+		static vk::AccessFlags GetReadAccess(BufferType type);
+
+		// --- Accessors ---
+		const vk::Buffer& Get() const { return m_buffer; }
+		BufferType GetType() const { return m_type; }
+		vk::DeviceSize GetSize() const { return m_size; }
+		void* GetMapped() const { return m_memory.Mapped; }
+		bool IsHostVisible() const { return m_memory.Mapped != nullptr; }
+		const VKAllocation& GetAllocation() const { return m_memory; }
+
+	private:
+		vk::Buffer m_buffer = nullptr;
+		VKAllocation m_memory;
+		BufferType m_type;
+		vk::DeviceSize m_size = 0;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -17,16 +17,53 @@
 namespace Helios::Engine::Renderer::Vulkan {
 
 
-	VKDeviceManager::VKDeviceManager(const VKInstance& instance, const VKSurface& surface)
+	namespace {
+
+		// Shared by VkPhysicalDeviceVulkan12Features and VkPhysicalDeviceDescriptorIndexingFeatures (same members)
+		template<typename Features>
+		bool SupportsDescriptorIndexing(const Features& supported)
+		{
+			return supported.runtimeDescriptorArray && supported.descriptorBindingPartiallyBound &&
+				supported.descriptorBindingUpdateUnusedWhilePending && supported.descriptorBindingStorageBufferUpdateAfterBind &&
+				supported.descriptorBindingSampledImageUpdateAfterBind;
+		}
+
+
+		template<typename Features>
+		void EnableDescriptorIndexing(Features& enable, const Features& supported)
+		{
+			enable
+				.setRuntimeDescriptorArray(VK_TRUE)
+				.setDescriptorBindingPartiallyBound(VK_TRUE)
+				.setDescriptorBindingUpdateUnusedWhilePending(VK_TRUE)
+				.setDescriptorBindingStorageBufferUpdateAfterBind(VK_TRUE)
+				.setDescriptorBindingSampledImageUpdateAfterBind(VK_TRUE)
+				.setShaderStorageBufferArrayNonUniformIndexing(supported.shaderStorageBufferArrayNonUniformIndexing)
+				.setShaderSampledImageArrayNonUniformIndexing(supported.shaderSampledImageArrayNonUniformIndexing);
+		}
+
+	} // anonymous namespace
+
+
+	VKDeviceManager::VKDeviceManager(const VKInstance& instance, const VKSurface* surface)
 		: m_Instance(instance)
 	{
+		// Nothing is presented without a surface
+		if (!surface)
+			m_deviceExtensionsInfo.required.erase(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+
 		PickPhysicalDevice(instance, surface);
 		CreateLogicalDevice(surface);
+
+		m_memoryAllocator = CreateScope<VKMemoryAllocator>(*this);
 	}
 
 
 	VKDeviceManager::~VKDeviceManager()
 	{
+		// Frees the remaining memory blocks, needs the device
+		m_memoryAllocator.reset();
+
 		if (m_logicalDevice) {
 			m_logicalDevice.destroy();
 			LOG_RENDER_DEBUG("VKDevMgr: Logical device destroyed.");
@@ -34,7 +71,7 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	void VKDeviceManager::PickPhysicalDevice(const VKInstance& instance, const VKSurface& surface)
+	void VKDeviceManager::PickPhysicalDevice(const VKInstance& instance, const VKSurface* surface)
 	{
 		std::vector<vk::PhysicalDevice> devices = instance.Get().enumeratePhysicalDevices();
 		if (devices.empty()) {
@@ -84,15 +121,16 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	void VKDeviceManager::CreateLogicalDevice(const VKSurface& surface)
+	void VKDeviceManager::CreateLogicalDevice(const VKSurface* surface)
 	{
 		m_queueIndices = FindQueueFamilies(m_physicalDevice, surface);
 
+		// The enabled list is rebuilt by every suitability check, make sure it matches the selected device
+		CheckDeviceExtensionSupport(m_physicalDevice);
+
 		std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
-		std::set<uint32_t> uniqueQueueFamilies = {
-			m_queueIndices.graphics.value(),
-			m_queueIndices.present.value()
-		};
+		std::set<uint32_t> uniqueQueueFamilies = { m_queueIndices.graphics.value() };
+		if (m_queueIndices.present.has_value()) { uniqueQueueFamilies.insert(m_queueIndices.present.value()); }
 		if (m_queueIndices.compute.has_value()) { uniqueQueueFamilies.insert(m_queueIndices.compute.value()); }
 		if (m_queueIndices.transfer.has_value()) { uniqueQueueFamilies.insert(m_queueIndices.transfer.value()); }
 
@@ -102,12 +140,46 @@ namespace Helios::Engine::Renderer::Vulkan {
 			queueCreateInfos.push_back(queueCreateInfo);
 		}
 
-		vk::PhysicalDeviceFeatures deviceFeatures{}; // No special features needed for now
+		// Core features of the indirect draw path (VKRenderer::DrawFrame falls back to direct draws)
+		vk::PhysicalDeviceFeatures supportedCore = m_physicalDevice.getFeatures();
+		m_features.multiDrawIndirect = supportedCore.multiDrawIndirect;
+		m_features.drawIndirectFirstInstance = supportedCore.drawIndirectFirstInstance;
+		vk::PhysicalDeviceFeatures enabledCore = vk::PhysicalDeviceFeatures()
+			.setMultiDrawIndirect(supportedCore.multiDrawIndirect)
+			.setDrawIndirectFirstInstance(supportedCore.drawIndirectFirstInstance);
+
+		// Descriptor indexing for the bindless heap. Vulkan 1.2 devices take it through VkPhysicalDeviceVulkan12Features
+		// (which must not be chained together with the promoted extension structs), older devices get it through
+		// VK_EXT_descriptor_indexing
+		vk::PhysicalDeviceVulkan12Features vulkan12Features;
+		vk::PhysicalDeviceDescriptorIndexingFeatures indexingFeatures;
+		void* featureChain = nullptr;
+		if (m_physicalDevice.getProperties().apiVersion >= VK_API_VERSION_1_2) {
+			auto supported = m_physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceVulkan12Features>();
+			const auto& vulkan12 = supported.get<vk::PhysicalDeviceVulkan12Features>();
+			m_features.descriptorIndexing = SupportsDescriptorIndexing(vulkan12);
+			if (m_features.descriptorIndexing)
+				EnableDescriptorIndexing(vulkan12Features, vulkan12);
+			featureChain = &vulkan12Features;
+		}
+		else if (IsExtensionEnabled(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME)) {
+			auto supported = m_physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceDescriptorIndexingFeatures>();
+			const auto& indexing = supported.get<vk::PhysicalDeviceDescriptorIndexingFeatures>();
+			m_features.descriptorIndexing = SupportsDescriptorIndexing(indexing);
+			if (m_features.descriptorIndexing) {
+				EnableDescriptorIndexing(indexingFeatures, indexing);
+				featureChain = &indexingFeatures;
+			}
+		}
+
+		vk::PhysicalDeviceFeatures2 deviceFeatures = vk::PhysicalDeviceFeatures2()
+			.setFeatures(enabledCore)
+			.setPNext(featureChain);
 
 		// Use the list of enabled extensions we gathered during device suitability checks
 		vk::DeviceCreateInfo createInfo;
 		createInfo.setQueueCreateInfos(queueCreateInfos);
-		createInfo.pEnabledFeatures = &deviceFeatures;
+		createInfo.setPNext(&deviceFeatures);
 		createInfo.setEnabledExtensionCount(static_cast<uint32_t>(m_deviceExtensionsInfo.enabled.size()));
 		createInfo.ppEnabledExtensionNames = m_deviceExtensionsInfo.enabled.data();
 
@@ -121,11 +193,15 @@ namespace Helios::Engine::Renderer::Vulkan {
 		}
 
 		m_logicalDevice = m_physicalDevice.createDevice(createInfo);
-		LOG_RENDER_DEBUG("VKDevMgr: Logical device created.");
+		LOG_RENDER_DEBUG("VKDevMgr: Logical device created ({} extension(s) enabled, descriptor indexing: {}, multi draw indirect: {}).",
+			m_deviceExtensionsInfo.enabled.size(), m_features.descriptorIndexing ? "yes" : "no",
+			(m_features.multiDrawIndirect && m_features.drawIndirectFirstInstance) ? "yes" : "no");
 
 		// Retrieve queue handles
 		m_Queues.graphics = m_logicalDevice.getQueue(m_queueIndices.graphics.value(), 0);
-		m_Queues.present = m_logicalDevice.getQueue(m_queueIndices.present.value(), 0);
+		if (m_queueIndices.present.has_value()) {
+			m_Queues.present = m_logicalDevice.getQueue(m_queueIndices.present.value(), 0);
+		}
 		if (m_queueIndices.compute.has_value()) {
 			m_Queues.compute = m_logicalDevice.getQueue(m_queueIndices.compute.value(), 0);
 		}
@@ -134,13 +210,13 @@ namespace Helios::Engine::Renderer::Vulkan {
 		}
 		LOG_RENDER_DEBUG("VKDevMgr: Queues created (Graphics: {}, Present: {}, Compute: {}, Transfer: {}).",
 			m_queueIndices.graphics.value(),
-			m_queueIndices.present.value(),
+			m_queueIndices.present.has_value() ? std::to_string(m_queueIndices.present.value()) : "N/A",
 			m_queueIndices.compute.has_value() ? std::to_string(m_queueIndices.compute.value()) : "N/A",
 			m_queueIndices.transfer.has_value() ? std::to_string(m_queueIndices.transfer.value()) : "N/A");
 	}
 
 
-	vk::PhysicalDevice VKDeviceManager::FindPreferredDevice(const std::vector<vk::PhysicalDevice>& devices, const VKSurface& surface)
+	vk::PhysicalDevice VKDeviceManager::FindPreferredDevice(const std::vector<vk::PhysicalDevice>& devices, const VKSurface* surface)
 	{
 		std::string preferredVendorID_str = ConfigManager::GetInstance().Get<std::string>("renderer_vulkan", "PhysicalDevice", "PreferredVendorID");
 		std::string preferredDeviceID_str = ConfigManager::GetInstance().Get<std::string>("renderer_vulkan", "PhysicalDevice", "PreferredDeviceID");
@@ -169,7 +245,30 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	bool VKDeviceManager::IsDeviceSuitable(vk::PhysicalDevice device, const VKSurface& surface)
+	uint32_t VKDeviceManager::FindMemoryType(uint32_t typeFilter, vk::MemoryPropertyFlags properties) const
+	{
+		vk::PhysicalDeviceMemoryProperties memProperties = m_physicalDevice.getMemoryProperties();
+		for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
+			if ((typeFilter & (1u << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties)
+				return i;
+		}
+
+		LOG_RENDER_EXCEPT("VKDevMgr: No suitable memory type found (filter 0x{:x}, properties {}).", typeFilter, vk::to_string(properties));
+		return 0;
+	}
+
+
+	bool VKDeviceManager::IsExtensionEnabled(std::string_view name) const
+	{
+		for (const char* ext : m_deviceExtensionsInfo.enabled) {
+			if (name == ext)
+				return true;
+		}
+		return false;
+	}
+
+
+	bool VKDeviceManager::IsDeviceSuitable(vk::PhysicalDevice device, const VKSurface* surface)
 	{
 		QueueFamilyIndices indices = FindQueueFamilies(device, surface);
 		bool extensionsSupported = CheckDeviceExtensionSupport(device);
@@ -182,11 +281,12 @@ namespace Helios::Engine::Renderer::Vulkan {
 			swapChainAdequate = true; // Placeholder for now
 		}
 
-		return indices.IsCompleteForPresentation() && extensionsSupported && swapChainAdequate;
+		bool queuesComplete = surface ? indices.IsCompleteForPresentation() : indices.IsCompleteForGraphics();
+		return queuesComplete && extensionsSupported && swapChainAdequate;
 	}
 
 
-	int VKDeviceManager::RateDeviceSuitability(vk::PhysicalDevice device, const VKSurface& surface)
+	int VKDeviceManager::RateDeviceSuitability(vk::PhysicalDevice device, const VKSurface* surface)
 	{
 		if (!IsDeviceSuitable(device, surface))
 			return 0;
@@ -217,7 +317,7 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	QueueFamilyIndices VKDeviceManager::FindQueueFamilies(vk::PhysicalDevice device, const VKSurface& surface)
+	QueueFamilyIndices VKDeviceManager::FindQueueFamilies(vk::PhysicalDevice device, const VKSurface* surface)
 	{
 		QueueFamilyIndices indices;
 		std::vector<vk::QueueFamilyProperties> queueFamilies = device.getQueueFamilyProperties();
@@ -246,7 +346,7 @@ namespace Helios::Engine::Renderer::Vulkan {
 			computeCandidates.insert({ scoreQueue(family, vk::QueueFlagBits::eCompute), i });
 			transferCandidates.insert({ scoreQueue(family, vk::QueueFlagBits::eTransfer), i });
 
-			if (device.getSurfaceSupportKHR(i, surface.Get())) {
+			if (surface && device.getSurfaceSupportKHR(i, surface->Get())) {
 				// For present, prefer a non-graphics queue
 				int presentScore = (family.queueFlags & vk::QueueFlagBits::eGraphics) ? 1 : 0;
 				presentCandidates.insert({ presentScore, i });
@@ -256,10 +356,13 @@ namespace Helios::Engine::Renderer::Vulkan {
 		// --- Assign best candidates, avoiding reuse if possible ---
 		std::set<uint32_t> assignedQueues;
 
-		// Must have graphics and present
+		// Must have graphics and present (present only with a surface)
+		if (graphicsCandidates.empty() || graphicsCandidates.begin()->first == 100)
+			return indices;
 		indices.graphics = graphicsCandidates.begin()->second;
 		assignedQueues.insert(indices.graphics.value());
-		indices.present = presentCandidates.begin()->second;
+		if (!presentCandidates.empty())
+			indices.present = presentCandidates.begin()->second;
 		// No need to add present to assignedQueues, as it can share with graphics
 
 		// Find best compute queue that is not already assigned
@@ -15,13 +15,23 @@
 // - Identifies and provides access to graphics, present, compute, and
 //   transfer queue families and their corresponding vk::Queues.
 // - Manages device-related resources in a RAII-compliant manner.
+// - Owns the VKMemoryAllocator for buffers and images (VK_EXT_memory_budget
+//   is enabled when available).
 // 
 // Changelog:
+// - 2026.10: Removed the indirect count feature (no GPU produced counts)
+// - 2026.10: Indirect draw features (multi draw, first instance, indirect count) in GetFeatures
+// - 2026.10: Descriptor indexing enabled when supported (GetFeatures, bindless heap)
+// - 2026.10: Added VKMemoryAllocator, optional VK_EXT_memory_budget, IsExtensionEnabled
+// - 2026.10: Surface is optional (headless: no present queue, no swapchain extension)
+//            Added FindMemoryType
 // - 2025.01: Added physical device selection persistence
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
 
+#include "Helios/Platform/Renderer/Vulkan/VKMemoryAllocator.h"
+
 namespace Helios::Engine::Renderer::Vulkan {
 
 
@@ -33,7 +43,7 @@ namespace Helios::Engine::Renderer::Vulkan {
 	// Struct to hold device extensions
 	struct DeviceExtensionInfo {
 		std::unordered_set<std::string> required = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
-		std::unordered_set<std::string> optional = { /*VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME*/ };
+		std::unordered_set<std::string> optional = { VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME /*, VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME*/ };
 		std::unordered_set<std::string> supported;
 		std::vector<const char*> enabled;
 	};
@@ -47,11 +57,20 @@ namespace Helios::Engine::Renderer::Vulkan {
 		std::optional<uint32_t> transfer;
 
 		bool IsCompleteForPresentation() const { return graphics.has_value() && present.has_value(); }
+		bool IsCompleteForGraphics() const { return graphics.has_value(); }
 		bool IsCompleteForCompute() const { return compute.has_value(); }
 		bool IsCompleteForTransfer() const { return transfer.has_value(); }
 	};
 
 
+	// Optional device features that were enabled on the logical device
+	struct DeviceFeatureInfo {
+		bool descriptorIndexing = false;        // runtime arrays, partially bound, update after bind (VKBindlessHeap)
+		bool multiDrawIndirect = false;         // drawCount > 1 in vkCmdDrawIndexedIndirect
+		bool drawIndirectFirstInstance = false; // firstInstance != 0 in indirect commands
+	};
+
+
 	struct VKQueues {
 		vk::Queue graphics;
 		vk::Queue present;
@@ -63,7 +82,8 @@ namespace Helios::Engine::Renderer::Vulkan {
 	class VKDeviceManager
 	{
 	public:
-		VKDeviceManager(const VKInstance& instance, const VKSurface& surface);
+		// surface == nullptr: headless device (no present queue, swapchain extension not required)
+		VKDeviceManager(const VKInstance& instance, const VKSurface* surface);
 		~VKDeviceManager();
 
 		// Prevent copying and moving
@@ -89,18 +109,27 @@ namespace Helios::Engine::Renderer::Vulkan {
 		const uint32_t GetComputeQueueIndex() const { return m_queueIndices.compute.value_or(0u); }
 		const uint32_t GetTransferQueueIndex() const { return m_queueIndices.transfer.value_or(0u); }
 
+		// Index of a memory type allowed by typeFilter (memoryTypeBits) with all requested properties, throws if none
+		uint32_t FindMemoryType(uint32_t typeFilter, vk::MemoryPropertyFlags properties) const;
+
+		// Device extension enabled on the logical device (required or available optional one)
+		bool IsExtensionEnabled(std::string_view name) const;
+		const DeviceFeatureInfo& GetFeatures() const { return m_features; }
+
+		VKMemoryAllocator& GetMemoryAllocator() const { return *m_memoryAllocator; }
+
 	private:
 		// --- Initialization Steps ---
-		void PickPhysicalDevice(const VKInstance& instance, const VKSurface& surface);
-		void CreateLogicalDevice(const VKSurface& surface);
+		void PickPhysicalDevice(const VKInstance& instance, const VKSurface* surface);
+		void CreateLogicalDevice(const VKSurface* surface);
 
 		// --- Helper Functions for Device Selection ---
-		vk::PhysicalDevice FindPreferredDevice(const std::vector<vk::PhysicalDevice>& devices, const VKSurface& surface);
-		bool IsDeviceSuitable(vk::PhysicalDevice device, const VKSurface& surface);
-		int RateDeviceSuitability(vk::PhysicalDevice device, const VKSurface& surface);
-		QueueFamilyIndices FindQueueFamilies(vk::PhysicalDevice device, const VKSurface& surface);
+		vk::PhysicalDevice FindPreferredDevice(const std::vector<vk::PhysicalDevice>& devices, const VKSurface* surface);
+		bool IsDeviceSuitable(vk::PhysicalDevice device, const VKSurface* surface);
+		int RateDeviceSuitability(vk::PhysicalDevice device, const VKSurface* surface);
+		QueueFamilyIndices FindQueueFamilies(vk::PhysicalDevice device, const VKSurface* surface);
 		bool CheckDeviceExtensionSupport(vk::PhysicalDevice device);
-		// SwapChainSupportDetails QuerySwapChainSupport(vk::PhysicalDevice device, const VKSurface& surface); // TODO: Implement next
+		// SwapChainSupportDetails QuerySwapChainSupport(vk::PhysicalDevice device, const VKSurface* surface); // TODO: Implement next
 
 	private:
 		vk::PhysicalDevice m_physicalDevice = nullptr;
@@ -113,6 +142,9 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		// Centralized list of device extensions
 		DeviceExtensionInfo m_deviceExtensionsInfo;
+		DeviceFeatureInfo m_features;
+
+		Scope<VKMemoryAllocator> m_memoryAllocator;
 	};
 
 
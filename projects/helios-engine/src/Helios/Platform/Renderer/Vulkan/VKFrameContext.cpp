@@ -0,0 +1,74 @@
+//==============================================================================
+// Vulkan Frame Context (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKFrameContext.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKFrameContext.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+#include "Helios/Engine/Core/Config.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	VKFrameContext::VKFrameContext(const VKDeviceManager& deviceManager, uint32_t framesInFlight)
+		: m_deviceManager(deviceManager)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		m_poolReset = ConfigManager::GetInstance().Get<bool>("renderer_vulkan", "Frame", "PoolReset", true);
+
+		// Transient: the buffers are re-recorded every frame
+		vk::CommandPoolCreateFlags poolFlags = vk::CommandPoolCreateFlagBits::eTransient;
+		if (!m_poolReset)
+			poolFlags |= vk::CommandPoolCreateFlagBits::eResetCommandBuffer;
+		vk::CommandPoolCreateInfo poolInfo = vk::CommandPoolCreateInfo()
+			.setFlags(poolFlags)
+			.setQueueFamilyIndex(m_deviceManager.GetGraphicsQueueIndex());
+
+		m_frames.resize(std::max(framesInFlight, 1u));
+		for (auto& frame : m_frames) {
+			frame.CommandPool = logicalDevice.createCommandPool(poolInfo);
+
+			vk::CommandBufferAllocateInfo allocInfo = vk::CommandBufferAllocateInfo()
+				.setCommandPool(frame.CommandPool)
+				.setLevel(vk::CommandBufferLevel::ePrimary)
+				.setCommandBufferCount(1);
+			frame.CommandBuffer = logicalDevice.allocateCommandBuffers(allocInfo)[0];
+		}
+
+		LOG_RENDER_DEBUG("VKFrameContext: Created ({} frame(s), {} reset).", m_frames.size(), m_poolReset ? "command pool" : "command buffer");
+	}
+
+
+	VKFrameContext::~VKFrameContext()
+	{
+		// Destroying the pools frees their command buffers
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		for (auto& frame : m_frames)
+			logicalDevice.destroyCommandPool(frame.CommandPool);
+		m_frames.clear();
+		LOG_RENDER_DEBUG("VKFrameContext: Destroyed.");
+	}
+
+
+	void VKFrameContext::BeginFrame(uint32_t frame)
+	{
+		HE_PROFILE_FUNCTION();
+
+		m_currentFrame = frame % static_cast<uint32_t>(m_frames.size());
+		FrameData& data = m_frames[m_currentFrame];
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		if (m_poolReset)
+			logicalDevice.resetCommandPool(data.CommandPool);
+		else
+			data.CommandBuffer.reset();
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,79 @@
+//==============================================================================
+// Vulkan Frame Context
+//
+// Per-frame resources of the frames in flight that are recycled as a whole:
+// one transient command pool with the frame's primary command buffer. Once
+// the fence of a frame has signaled, BeginFrame() resets the pool with one
+// call instead of resetting every command buffer.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - vkResetCommandPool per frame in flight, the pool is created without
+//   VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT (drivers can keep the
+//   memory in one linear block).
+// - renderer_vulkan/Frame/PoolReset = false falls back to resetting the
+//   command buffer alone (resettable pool), to compare both with FrameStats.
+//
+// Notes:
+// - Render thread only. Parallel recording has its own pools (VKParallelRecorder).
+// - Other per-frame resources (staging, bindless slots, secondaries) are
+//   recycled by their owners at the same point, see VKRenderer::RecycleFrame.
+// - No frame-lifetime descriptor pools: per-draw data goes through push
+//   constants and the bindless heap, nothing allocates descriptor sets per frame.
+//
+// Usage:
+//   frameContext.BeginFrame(frame); // after the fence wait
+//   vk::CommandBuffer cmd = frameContext.GetCommandBuffer();
+//
+// Changelog:
+// - 2026.10: Removed the unused frame-lifetime descriptor pools (AllocateDescriptorSet)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	class VKFrameContext
+	{
+	public:
+		VKFrameContext(const VKDeviceManager& deviceManager, uint32_t framesInFlight);
+		~VKFrameContext();
+
+		// Prevent copying and moving
+		VKFrameContext(const VKFrameContext&) = delete;
+		VKFrameContext& operator=(const VKFrameContext&) = delete;
+		VKFrameContext(VKFrameContext&&) = delete;
+		VKFrameContext& operator=(VKFrameContext&&) = delete;
+
+		// Call after the fence of 'frame' was waited for. Resets the frame's pool, its primary
+		// command buffer (GetCommandBuffer) is in the initial state afterwards.
+		void BeginFrame(uint32_t frame);
+
+		// --- Accessors ---
+		vk::CommandBuffer GetCommandBuffer() const { return m_frames[m_currentFrame].CommandBuffer; }
+		bool UsesPoolReset() const { return m_poolReset; }
+
+	private:
+		struct FrameData
+		{
+			vk::CommandPool CommandPool;
+			vk::CommandBuffer CommandBuffer;
+		};
+
+	private:
+		std::vector<FrameData> m_frames;
+		uint32_t m_currentFrame = 0;
+		bool m_poolReset = true;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
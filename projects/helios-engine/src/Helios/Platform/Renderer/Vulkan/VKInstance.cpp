@@ -44,6 +44,7 @@ namespace Helios::Engine::Renderer::Vulkan {
 	{
 		if (m_enableValidationLayers && !CheckValidationLayerSupport()) {
 			LOG_RENDER_WARN("VKInstance: Validation layers requested, but not available!");
+			m_enableValidationLayers = false;
 		}
 
 		CheckInstanceExtensionSupport();
@@ -18,6 +18,7 @@
 // - Provides a temporary debug messenger for instance creation/destruction.
 // 
 // Changelog:
+// - 2026.10: Validation layers are disabled when not available (e.g. CI)
 // - 2026.01: Added static methods to disable specific debug message IDs
 // - 2026.01: Refactored to use a builder pattern
 // - 2026.01: Refactored extension handling
@@ -0,0 +1,654 @@
+//==============================================================================
+// Vulkan Device Memory Allocator (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKMemoryAllocator.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKMemoryAllocator.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+#include "Helios/Engine/Core/Config.h"
+
+#include <bit>
+#include <unordered_map>
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	struct VKMemoryBlock
+	{
+		vk::DeviceMemory Memory = nullptr;
+		vk::DeviceSize Size = 0;    // power of two
+		uint8_t* Mapped = nullptr;
+		uint32_t MemoryType = 0;
+		uint32_t HeapIndex = 0;
+		uint32_t PoolIndex = 0;
+		uint32_t MaxOrder = 0;      // order of Size
+		vk::DeviceSize Used = 0;
+
+		// Free offsets per order (size MinAllocationSize << order), ordered so the lowest offset is used first
+		std::vector<std::set<vk::DeviceSize>> FreeLists;
+		std::unordered_map<vk::DeviceSize, uint32_t> Allocated; // offset -> order
+	};
+
+
+	namespace {
+
+		constexpr double DefaultBudgetFraction = 0.8; // of the heap size without VK_EXT_memory_budget
+
+		uint32_t CountBits(vk::MemoryPropertyFlags flags)
+		{
+			return static_cast<uint32_t>(std::popcount(static_cast<uint32_t>(static_cast<VkMemoryPropertyFlags>(flags))));
+		}
+
+		double ToMiB(vk::DeviceSize bytes)
+		{
+			return static_cast<double>(bytes) / (1024.0 * 1024.0);
+		}
+
+	} // anonymous namespace
+
+
+	VKMemoryAllocator::VKMemoryAllocator(const VKDeviceManager& deviceManager)
+		: m_deviceManager(deviceManager)
+	{
+		const vk::PhysicalDevice& physicalDevice = m_deviceManager.GetPhysicalDevice();
+		m_memoryProperties = physicalDevice.getMemoryProperties();
+		m_nonCoherentAtomSize = std::max<vk::DeviceSize>(physicalDevice.getProperties().limits.nonCoherentAtomSize, 1);
+		m_hasMemoryBudget = m_deviceManager.IsExtensionEnabled(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+
+		// Block size is rounded down to a power of two for the buddy allocator
+		int blockSizeMB = std::clamp(ConfigManager::GetInstance().Get<int>("renderer_vulkan", "Memory", "BlockSizeMB", 64), 1, 1024);
+		m_blockSize = std::bit_floor(static_cast<vk::DeviceSize>(blockSizeMB) << 20);
+		m_maxOrder = GetOrder(m_blockSize);
+
+		int dedicatedMB = ConfigManager::GetInstance().Get<int>("renderer_vulkan", "Memory", "DedicatedThresholdMB", blockSizeMB / 2);
+		m_dedicatedThreshold = std::clamp<vk::DeviceSize>(static_cast<vk::DeviceSize>(std::max(dedicatedMB, 0)) << 20, MinAllocationSize, m_blockSize);
+
+		m_pools.resize(static_cast<size_t>(m_memoryProperties.memoryTypeCount) * 2);
+		for (size_t i = 0; i < m_pools.size(); i++)
+			m_pools[i].MemoryType = static_cast<uint32_t>(i / 2);
+
+		const size_t heapCount = m_memoryProperties.memoryHeapCount;
+		m_heapBlockBytes.assign(heapCount, 0);
+		m_heapAllocationBytes.assign(heapCount, 0);
+		m_heapBlockBytesAtUpdate.assign(heapCount, 0);
+		m_heapUsage.assign(heapCount, 0);
+		m_heapBudget.assign(heapCount, 0);
+		UpdateBudget();
+
+		LOG_RENDER_DEBUG("VKMemAlloc: Created (block size {:.0f} MiB, dedicated above {:.1f} MiB, {} memory types, {} heaps, memory budget {}).",
+			ToMiB(m_blockSize), ToMiB(m_dedicatedThreshold), m_memoryProperties.memoryTypeCount, heapCount,
+			m_hasMemoryBudget ? "VK_EXT_memory_budget" : "estimated");
+	}
+
+
+	VKMemoryAllocator::~VKMemoryAllocator()
+	{
+		std::lock_guard lock(m_mutex);
+
+		uint32_t leaked = 0;
+		for (auto& pool : m_pools) {
+			for (auto& block : pool.Blocks) {
+				leaked += static_cast<uint32_t>(block->Allocated.size());
+				DestroyBlock(*block);
+			}
+			pool.Blocks.clear();
+		}
+
+		if (leaked || m_dedicatedCount)
+			LOG_RENDER_WARN("VKMemAlloc: {} sub-allocation(s) and {} dedicated allocation(s) not freed before shutdown.", leaked, m_dedicatedCount);
+		LOG_RENDER_DEBUG("VKMemAlloc: Destroyed.");
+	}
+
+
+	VKAllocation VKMemoryAllocator::AllocateForBuffer(vk::Buffer buffer, const VKAllocationInfo& info)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		auto chain = logicalDevice.getBufferMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>(
+			vk::BufferMemoryRequirementsInfo2().setBuffer(buffer));
+		const auto& requirements = chain.get<vk::MemoryRequirements2>().memoryRequirements;
+		const auto& dedicated = chain.get<vk::MemoryDedicatedRequirements>();
+		bool prefersDedicated = dedicated.prefersDedicatedAllocation || dedicated.requiresDedicatedAllocation;
+
+		VKAllocation allocation = AllocateInternal(requirements, info, false, prefersDedicated, buffer, nullptr);
+		logicalDevice.bindBufferMemory(buffer, allocation.Memory, allocation.Offset);
+		return allocation;
+	}
+
+
+	VKAllocation VKMemoryAllocator::AllocateForImage(vk::Image image, const VKAllocationInfo& info)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		auto chain = logicalDevice.getImageMemoryRequirements2<vk::MemoryRequirements2, vk::MemoryDedicatedRequirements>(
+			vk::ImageMemoryRequirementsInfo2().setImage(image));
+		const auto& requirements = chain.get<vk::MemoryRequirements2>().memoryRequirements;
+		const auto& dedicated = chain.get<vk::MemoryDedicatedRequirements>();
+		bool prefersDedicated = dedicated.prefersDedicatedAllocation || dedicated.requiresDedicatedAllocation;
+
+		// Linear images could share the buffer pools, but they are rare enough to not track the tiling
+		VKAllocation allocation = AllocateInternal(requirements, info, true, prefersDedicated, nullptr, image);
+		logicalDevice.bindImageMemory(image, allocation.Memory, allocation.Offset);
+		return allocation;
+	}
+
+
+	VKAllocation VKMemoryAllocator::Allocate(const vk::MemoryRequirements& requirements, const VKAllocationInfo& info, bool optimalImage)
+	{
+		return AllocateInternal(requirements, info, optimalImage, false, nullptr, nullptr);
+	}
+
+
+	VKAllocation VKMemoryAllocator::AllocateInternal(const vk::MemoryRequirements& requirements, const VKAllocationInfo& info, bool optimalImage, bool prefersDedicated, vk::Buffer dedicatedBuffer, vk::Image dedicatedImage)
+	{
+		if (requirements.size == 0) {
+			LOG_RENDER_EXCEPT("VKMemAlloc: Zero sized allocation requested.");
+		}
+
+		uint32_t memoryType = FindMemoryType(requirements.memoryTypeBits, info.Usage);
+		if (memoryType == UINT32_MAX) {
+			LOG_RENDER_EXCEPT("VKMemAlloc: No memory type for usage {} (filter 0x{:x}).", static_cast<int>(info.Usage), requirements.memoryTypeBits);
+		}
+
+		// Buddy offsets are aligned to their size, so rounding the size up covers the alignment too
+		vk::DeviceSize size = std::max(requirements.size, requirements.alignment);
+
+		std::lock_guard lock(m_mutex);
+
+		if (info.Dedicated || prefersDedicated || size > m_dedicatedThreshold)
+			return AllocateDedicated(requirements.size, memoryType, dedicatedBuffer, dedicatedImage);
+
+		uint32_t order = GetOrder(size);
+		uint32_t poolIndex = memoryType * 2 + (optimalImage ? 1 : 0);
+		Pool& pool = m_pools[poolIndex];
+
+		VKAllocation allocation;
+		for (auto& block : pool.Blocks) {
+			if (block->MaxOrder >= order && AllocateFromBlock(*block, order, requirements.size, allocation))
+				return allocation;
+		}
+
+		VKMemoryBlock* block = CreateBlock(pool, poolIndex, MinAllocationSize << order);
+		if (!block || !AllocateFromBlock(*block, order, requirements.size, allocation)) {
+			LOG_RENDER_EXCEPT("VKMemAlloc: Out of device memory ({:.2f} MiB, memory type {}).", ToMiB(requirements.size), memoryType);
+		}
+		return allocation;
+	}
+
+
+	VKAllocation VKMemoryAllocator::AllocateDedicated(vk::DeviceSize size, uint32_t memoryType, vk::Buffer dedicatedBuffer, vk::Image dedicatedImage)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		const vk::MemoryType& type = m_memoryProperties.memoryTypes[memoryType];
+
+		vk::MemoryDedicatedAllocateInfo dedicatedInfo = vk::MemoryDedicatedAllocateInfo()
+			.setImage(dedicatedImage)
+			.setBuffer(dedicatedBuffer);
+		vk::MemoryAllocateInfo allocInfo = vk::MemoryAllocateInfo()
+			.setAllocationSize(size)
+			.setMemoryTypeIndex(memoryType);
+		if (dedicatedBuffer || dedicatedImage)
+			allocInfo.setPNext(&dedicatedInfo);
+
+		VKAllocation allocation;
+		try {
+			allocation.Memory = logicalDevice.allocateMemory(allocInfo);
+		}
+		catch (const vk::SystemError& e) {
+			LOG_RENDER_EXCEPT("VKMemAlloc: Dedicated allocation of {:.2f} MiB failed: {}", ToMiB(size), e.what());
+		}
+		allocation.Size = size;
+		allocation.MemoryType = memoryType;
+		if (type.propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible)
+			allocation.Mapped = logicalDevice.mapMemory(allocation.Memory, 0, VK_WHOLE_SIZE);
+
+		m_dedicatedCount++;
+		m_dedicatedBytes += size;
+		m_heapBlockBytes[type.heapIndex] += size;
+		m_heapAllocationBytes[type.heapIndex] += size;
+		return allocation;
+	}
+
+
+	bool VKMemoryAllocator::AllocateFromBlock(VKMemoryBlock& block, uint32_t order, vk::DeviceSize size, VKAllocation& allocation)
+	{
+		uint32_t k = order;
+		while (k <= block.MaxOrder && block.FreeLists[k].empty())
+			k++;
+		if (k > block.MaxOrder)
+			return false;
+
+		vk::DeviceSize offset = *block.FreeLists[k].begin();
+		block.FreeLists[k].erase(block.FreeLists[k].begin());
+
+		// Split down to the requested order, the upper halves become free buddies
+		while (k > order) {
+			k--;
+			block.FreeLists[k].insert(offset + (MinAllocationSize << k));
+		}
+
+		const vk::DeviceSize allocSize = MinAllocationSize << order;
+		block.Allocated.emplace(offset, order);
+		block.Used += allocSize;
+		m_heapAllocationBytes[block.HeapIndex] += allocSize;
+
+		allocation.Memory = block.Memory;
+		allocation.Offset = offset;
+		allocation.Size = size;
+		allocation.Mapped = block.Mapped ? block.Mapped + offset : nullptr;
+		allocation.MemoryType = block.MemoryType;
+		allocation.Block = &block;
+		return true;
+	}
+
+
+	VKMemoryBlock* VKMemoryAllocator::CreateBlock(Pool& pool, uint32_t poolIndex, vk::DeviceSize minSize)
+	{
+		const vk::MemoryType& type = m_memoryProperties.memoryTypes[pool.MemoryType];
+		const vk::DeviceSize heapSize = m_memoryProperties.memoryHeaps[type.heapIndex].size;
+
+		// Small heaps (e.g. the 256 MiB host visible device local window) get smaller blocks,
+		// and so does a heap close to its budget
+		vk::DeviceSize size = m_blockSize;
+		while (size > minSize && size > heapSize / 8)
+			size >>= 1;
+
+		VKMemoryBudget budget = GetBudgetLocked(type.heapIndex);
+		while (size > minSize && budget.Usage + size > budget.Budget)
+			size >>= 1;
+		if (budget.Usage + size > budget.Budget)
+			LOG_RENDER_WARN("VKMemAlloc: Heap {} over budget ({:.1f} of {:.1f} MiB used).", type.heapIndex, ToMiB(budget.Usage + size), ToMiB(budget.Budget));
+
+		// Retry with smaller blocks when the driver is out of memory
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		vk::DeviceMemory memory = nullptr;
+		while (!memory) {
+			try {
+				memory = logicalDevice.allocateMemory(vk::MemoryAllocateInfo().setAllocationSize(size).setMemoryTypeIndex(pool.MemoryType));
+			}
+			catch (const vk::SystemError& e) {
+				if (size <= minSize) {
+					LOG_RENDER_ERROR("VKMemAlloc: Block allocation of {:.2f} MiB failed: {}", ToMiB(size), e.what());
+					return nullptr;
+				}
+				size >>= 1;
+			}
+		}
+
+		auto block = CreateScope<VKMemoryBlock>();
+		block->Memory = memory;
+		block->Size = size;
+		block->MemoryType = pool.MemoryType;
+		block->HeapIndex = type.heapIndex;
+		block->PoolIndex = poolIndex;
+		block->MaxOrder = GetOrder(size);
+		block->FreeLists.resize(block->MaxOrder + 1);
+		block->FreeLists[block->MaxOrder].insert(0);
+		if (type.propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible)
+			block->Mapped = static_cast<uint8_t*>(logicalDevice.mapMemory(memory, 0, VK_WHOLE_SIZE));
+
+		m_heapBlockBytes[type.heapIndex] += size;
+		LOG_RENDER_DEBUG("VKMemAlloc: Block of {:.2f} MiB created (memory type {}, {}).",
+			ToMiB(size), pool.MemoryType, (poolIndex & 1) ? "images" : "buffers");
+
+		pool.Blocks.push_back(std::move(block));
+		return pool.Blocks.back().get();
+	}
+
+
+	void VKMemoryAllocator::Free(VKAllocation& allocation)
+	{
+		if (!allocation)
+			return;
+
+		std::lock_guard lock(m_mutex);
+		FreeInternal(allocation);
+		allocation = {};
+	}
+
+
+	void VKMemoryAllocator::FreeInternal(VKAllocation& allocation)
+	{
+		const uint32_t heapIndex = m_memoryProperties.memoryTypes[allocation.MemoryType].heapIndex;
+
+		if (!allocation.Block) {
+			m_deviceManager.GetLogicalDevice().freeMemory(allocation.Memory);
+			m_dedicatedCount--;
+			m_dedicatedBytes -= allocation.Size;
+			m_heapBlockBytes[heapIndex] -= allocation.Size;
+			m_heapAllocationBytes[heapIndex] -= allocation.Size;
+			return;
+		}
+
+		VKMemoryBlock& block = *allocation.Block;
+		auto it = block.Allocated.find(allocation.Offset);
+		if (it == block.Allocated.end()) {
+			LOG_RENDER_ERROR("VKMemAlloc: Free of unknown allocation (offset {}), ignored.", allocation.Offset);
+			return;
+		}
+
+		uint32_t order = it->second;
+		vk::DeviceSize offset = allocation.Offset;
+		block.Allocated.erase(it);
+		block.Used -= MinAllocationSize << order;
+		m_heapAllocationBytes[heapIndex] -= MinAllocationSize << order;
+
+		// Merge with the free buddy as long as there is one
+		while (order < block.MaxOrder) {
+			vk::DeviceSize buddy = offset ^ (MinAllocationSize << order);
+			auto buddyIt = block.FreeLists[order].find(buddy);
+			if (buddyIt == block.FreeLists[order].end())
+				break;
+			block.FreeLists[order].erase(buddyIt);
+			offset = std::min(offset, buddy);
+			order++;
+		}
+		block.FreeLists[order].insert(offset);
+
+		// One empty block per pool stays around to avoid allocate/free churn
+		if (block.Allocated.empty())
+			ReleaseEmptyBlocks(m_pools[block.PoolIndex], 1);
+	}
+
+
+	void VKMemoryAllocator::DestroyBlock(VKMemoryBlock& block)
+	{
+		// Freeing implicitly unmaps
+		m_deviceManager.GetLogicalDevice().freeMemory(block.Memory);
+		m_heapBlockBytes[block.HeapIndex] -= block.Size;
+		block.Memory = nullptr;
+	}
+
+
+	void VKMemoryAllocator::ReleaseEmptyBlocks(Pool& pool, uint32_t keep)
+	{
+		uint32_t empty = 0;
+		for (auto it = pool.Blocks.begin(); it != pool.Blocks.end();) {
+			if ((*it)->Allocated.empty() && ++empty > keep) {
+				LOG_RENDER_DEBUG("VKMemAlloc: Empty block of {:.2f} MiB released (memory type {}).", ToMiB((*it)->Size), pool.MemoryType);
+				DestroyBlock(**it);
+				it = pool.Blocks.erase(it);
+			}
+			else {
+				++it;
+			}
+		}
+	}
+
+
+	void VKMemoryAllocator::Flush(const VKAllocation& allocation, vk::DeviceSize offset, vk::DeviceSize size) const
+	{
+		FlushOrInvalidate(allocation, offset, size, true);
+	}
+
+
+	void VKMemoryAllocator::Invalidate(const VKAllocation& allocation, vk::DeviceSize offset, vk::DeviceSize size) const
+	{
+		FlushOrInvalidate(allocation, offset, size, false);
+	}
+
+
+	void VKMemoryAllocator::FlushOrInvalidate(const VKAllocation& allocation, vk::DeviceSize offset, vk::DeviceSize size, bool flush) const
+	{
+		if (!allocation)
+			return;
+
+		const vk::MemoryPropertyFlags flags = m_memoryProperties.memoryTypes[allocation.MemoryType].propertyFlags;
+		if (!(flags & vk::MemoryPropertyFlagBits::eHostVisible) || (flags & vk::MemoryPropertyFlagBits::eHostCoherent))
+			return;
+
+		if (size == VK_WHOLE_SIZE)
+			size = allocation.Size - std::min(offset, allocation.Size);
+		if (size == 0)
+			return;
+
+		// Ranges must be multiples of nonCoherentAtomSize (or end at the end of the memory object)
+		const vk::DeviceSize memorySize = allocation.Block ? allocation.Block->Size : allocation.Size;
+		vk::DeviceSize begin = (allocation.Offset + offset) / m_nonCoherentAtomSize * m_nonCoherentAtomSize;
+		vk::DeviceSize end = (allocation.Offset + offset + size + m_nonCoherentAtomSize - 1) / m_nonCoherentAtomSize * m_nonCoherentAtomSize;
+		end = std::min(end, memorySize);
+
+		vk::MappedMemoryRange range = vk::MappedMemoryRange()
+			.setMemory(allocation.Memory)
+			.setOffset(begin)
+			.setSize(end == memorySize ? VK_WHOLE_SIZE : end - begin);
+
+		if (flush)
+			m_deviceManager.GetLogicalDevice().flushMappedMemoryRanges(range);
+		else
+			m_deviceManager.GetLogicalDevice().invalidateMappedMemoryRanges(range);
+	}
+
+
+	uint32_t VKMemoryAllocator::FindMemoryType(uint32_t typeFilter, MemoryUsage usage) const
+	{
+		using Bits = vk::MemoryPropertyFlagBits;
+		vk::MemoryPropertyFlags required, preferred, avoided;
+		switch (usage) {
+			case MemoryUsage::GpuOnly:
+				preferred = Bits::eDeviceLocal;
+				avoided = Bits::eHostVisible;
+				break;
+			case MemoryUsage::Upload:
+				required = Bits::eHostVisible;
+				preferred = Bits::eHostCoherent;
+				avoided = Bits::eDeviceLocal | Bits::eHostCached;
+				break;
+			case MemoryUsage::Readback:
+				required = Bits::eHostVisible;
+				preferred = Bits::eHostCached | Bits::eHostCoherent;
+				break;
+			case MemoryUsage::Dynamic:
+				required = Bits::eHostVisible;
+				preferred = Bits::eDeviceLocal | Bits::eHostCoherent;
+				break;
+		}
+
+		// Lowest cost wins: one point per missing preferred and per present avoided property
+		uint32_t best = UINT32_MAX;
+		uint32_t bestCost = UINT32_MAX;
+		for (uint32_t i = 0; i < m_memoryProperties.memoryTypeCount; i++) {
+			const vk::MemoryPropertyFlags flags = m_memoryProperties.memoryTypes[i].propertyFlags;
+			if (!(typeFilter & (1u << i)) || (flags & required) != required)
+				continue;
+			if (flags & (Bits::eProtected | Bits::eLazilyAllocated))
+				continue;
+
+			uint32_t cost = CountBits(preferred & ~flags) + CountBits(avoided & flags);
+			if (cost < bestCost) {
+				best = i;
+				bestCost = cost;
+			}
+		}
+		return best;
+	}
+
+
+	uint32_t VKMemoryAllocator::GetOrder(vk::DeviceSize size) const
+	{
+		uint32_t order = 0;
+		while ((MinAllocationSize << order) < size)
+			order++;
+		return order;
+	}
+
+
+	std::vector<VKDefragMove> VKMemoryAllocator::PlanDefragmentation(const std::vector<VKAllocation*>& allocations, vk::DeviceSize maxBytes)
+	{
+		std::lock_guard lock(m_mutex);
+
+		std::unordered_map<VKMemoryBlock*, std::vector<VKAllocation*>> byBlock;
+		for (VKAllocation* allocation : allocations) {
+			if (allocation && allocation->Block)
+				byBlock[allocation->Block].push_back(allocation);
+		}
+
+		std::vector<VKDefragMove> moves;
+		vk::DeviceSize movedBytes = 0;
+
+		for (auto& pool : m_pools)
+		{
+			if (pool.Blocks.size() < 2)
+				continue;
+
+			// Fullest blocks first, allocations move from the back to the front
+			std::vector<VKMemoryBlock*> blocks;
+			for (auto& block : pool.Blocks)
+				blocks.push_back(block.get());
+			std::stable_sort(blocks.begin(), blocks.end(), [](const VKMemoryBlock* a, const VKMemoryBlock* b) { return a->Used > b->Used; });
+
+			for (size_t src = blocks.size() - 1; src > 0; src--)
+			{
+				auto it = byBlock.find(blocks[src]);
+				if (it == byBlock.end())
+					continue;
+
+				// Big allocations first, they are the hardest to place later
+				auto& candidates = it->second;
+				std::sort(candidates.begin(), candidates.end(), [](const VKAllocation* a, const VKAllocation* b) { return a->Size > b->Size; });
+
+				for (VKAllocation* candidate : candidates)
+				{
+					auto allocated = blocks[src]->Allocated.find(candidate->Offset);
+					if (allocated == blocks[src]->Allocated.end())
+						continue;
+
+					uint32_t order = allocated->second;
+					if (movedBytes + (MinAllocationSize << order) > maxBytes)
+						return moves;
+
+					for (size_t dst = 0; dst < src; dst++) {
+						VKDefragMove move;
+						move.Allocation = candidate;
+						if (blocks[dst]->MaxOrder >= order && AllocateFromBlock(*blocks[dst], order, candidate->Size, move.Destination)) {
+							moves.push_back(move);
+							movedBytes += MinAllocationSize << order;
+							break;
+						}
+					}
+				}
+			}
+		}
+
+		if (!moves.empty())
+			LOG_RENDER_DEBUG("VKMemAlloc: Defragmentation planned ({} move(s), {:.2f} MiB).", moves.size(), ToMiB(movedBytes));
+		return moves;
+	}
+
+
+	void VKMemoryAllocator::CommitDefragmentation(std::vector<VKDefragMove>& moves)
+	{
+		std::lock_guard lock(m_mutex);
+
+		for (auto& move : moves) {
+			FreeInternal(*move.Allocation);
+			*move.Allocation = move.Destination;
+		}
+		moves.clear();
+
+		// Emptied blocks are the point of defragmenting, keep none of them
+		for (auto& pool : m_pools)
+			ReleaseEmptyBlocks(pool, 0);
+	}
+
+
+	void VKMemoryAllocator::CancelDefragmentation(std::vector<VKDefragMove>& moves)
+	{
+		std::lock_guard lock(m_mutex);
+
+		for (auto& move : moves)
+			FreeInternal(move.Destination);
+		moves.clear();
+	}
+
+
+	void VKMemoryAllocator::UpdateBudget()
+	{
+		if (!m_hasMemoryBudget)
+			return;
+
+		auto chain = m_deviceManager.GetPhysicalDevice().getMemoryProperties2<vk::PhysicalDeviceMemoryProperties2, vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+		const auto& budget = chain.get<vk::PhysicalDeviceMemoryBudgetPropertiesEXT>();
+
+		std::lock_guard lock(m_mutex);
+		for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; i++) {
+			m_heapUsage[i] = budget.heapUsage[i];
+			m_heapBudget[i] = budget.heapBudget[i];
+			m_heapBlockBytesAtUpdate[i] = m_heapBlockBytes[i];
+		}
+	}
+
+
+	VKMemoryBudget VKMemoryAllocator::GetBudget(uint32_t heapIndex) const
+	{
+		std::lock_guard lock(m_mutex);
+		return GetBudgetLocked(heapIndex);
+	}
+
+
+	VKMemoryBudget VKMemoryAllocator::GetBudgetLocked(uint32_t heapIndex) const
+	{
+		VKMemoryBudget budget;
+		if (heapIndex >= m_memoryProperties.memoryHeapCount)
+			return budget;
+
+		budget.BlockBytes = m_heapBlockBytes[heapIndex];
+		budget.AllocationBytes = m_heapAllocationBytes[heapIndex];
+
+		if (m_hasMemoryBudget) {
+			// Driver values are from the last UpdateBudget, own changes since then are added
+			int64_t delta = static_cast<int64_t>(budget.BlockBytes) - static_cast<int64_t>(m_heapBlockBytesAtUpdate[heapIndex]);
+			budget.Usage = static_cast<vk::DeviceSize>(std::max<int64_t>(static_cast<int64_t>(m_heapUsage[heapIndex]) + delta, 0));
+			budget.Budget = m_heapBudget[heapIndex];
+		}
+		else {
+			budget.Usage = budget.BlockBytes;
+			budget.Budget = static_cast<vk::DeviceSize>(static_cast<double>(m_memoryProperties.memoryHeaps[heapIndex].size) * DefaultBudgetFraction);
+		}
+		return budget;
+	}
+
+
+	VKMemoryStats VKMemoryAllocator::GetStats() const
+	{
+		std::lock_guard lock(m_mutex);
+
+		VKMemoryStats stats;
+		for (const auto& pool : m_pools) {
+			for (const auto& block : pool.Blocks) {
+				stats.BlockCount++;
+				stats.BlockBytes += block->Size;
+				stats.UsedBytes += block->Used;
+				stats.AllocationCount += static_cast<uint32_t>(block->Allocated.size());
+			}
+		}
+		stats.DedicatedCount = m_dedicatedCount;
+		stats.DedicatedBytes = m_dedicatedBytes;
+		stats.AllocationCount += m_dedicatedCount;
+		return stats;
+	}
+
+
+	void VKMemoryAllocator::LogStats() const
+	{
+		VKMemoryStats stats = GetStats();
+		LOG_RENDER_INFO("VKMemAlloc: {} allocation(s), {} block(s) {:.2f} MiB ({:.1f}% used), {} dedicated {:.2f} MiB.",
+			stats.AllocationCount, stats.BlockCount, ToMiB(stats.BlockBytes),
+			stats.BlockBytes ? 100.0 * static_cast<double>(stats.UsedBytes) / static_cast<double>(stats.BlockBytes) : 0.0,
+			stats.DedicatedCount, ToMiB(stats.DedicatedBytes));
+
+		for (uint32_t i = 0; i < m_memoryProperties.memoryHeapCount; i++) {
+			VKMemoryBudget budget = GetBudget(i);
+			LOG_RENDER_INFO("VKMemAlloc: Heap {}: {:.1f} / {:.1f} MiB (own {:.1f} MiB){}", i, ToMiB(budget.Usage), ToMiB(budget.Budget), ToMiB(budget.BlockBytes),
+				(m_memoryProperties.memoryHeaps[i].flags & vk::MemoryHeapFlagBits::eDeviceLocal) ? ", device local" : "");
+		}
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
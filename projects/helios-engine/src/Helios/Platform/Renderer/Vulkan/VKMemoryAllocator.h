@@ -0,0 +1,209 @@
+//==============================================================================
+// Vulkan Device Memory Allocator
+//
+// Sub-allocates buffers and images from large vk::DeviceMemory blocks instead
+// of one vkAllocateMemory per resource (drivers limit the number of live
+// allocations, see maxMemoryAllocationCount, and each call is expensive).
+// Blocks are kept per memory type and split with a buddy allocator; big
+// resources, and resources the driver wants on their own, get dedicated
+// allocations. Heap usage is tracked against the budget reported by
+// VK_EXT_memory_budget when the device supports it.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Buddy sub-allocation (power-of-two sizes from MinAllocationSize up to the
+//   block size), O(log n) allocate and free with buddy merging.
+// - Separate block pools for buffers/linear images and optimal-tiling images,
+//   so bufferImageGranularity never has to be considered.
+// - Dedicated allocations above renderer_vulkan/Memory/DedicatedThresholdMB
+//   or when VkMemoryDedicatedRequirements asks for them.
+// - Host visible memory is persistently mapped (VKAllocation::Mapped).
+// - Memory budget per heap (VK_EXT_memory_budget, else 80% of the heap size).
+// - Defragmentation: plans moves out of sparsely used blocks, the caller
+//   copies the data and rebinds its resources, then commits the plan.
+//
+// Notes:
+// - The allocator is owned by the VKDeviceManager (GetMemoryAllocator) and is
+//   thread-safe.
+// - Free only after the GPU is done with the resource (e.g. after the fence of
+//   the frame that last used it).
+//
+// Usage:
+//   auto& allocator = deviceManager.GetMemoryAllocator();
+//   vk::Buffer buffer = device.createBuffer(bufferInfo);
+//   VKAllocation memory = allocator.AllocateForBuffer(buffer, { MemoryUsage::Upload });
+//   std::memcpy(memory.Mapped, data, size);
+//   ...
+//   device.destroyBuffer(buffer);
+//   allocator.Free(memory);
+//
+// Changelog:
+// - 2026.10: Added GetDedicatedThreshold
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+	struct VKMemoryBlock;
+
+
+	enum class MemoryUsage
+	{
+		GpuOnly,   // device local, not mapped (render targets, static geometry, textures)
+		Upload,    // host visible, preferably not device local (staging buffers)
+		Readback,  // host visible, preferably cached (GPU -> CPU copies)
+		Dynamic    // host visible, preferably device local (per-frame data written by the CPU)
+	};
+
+
+	struct VKAllocationInfo
+	{
+		MemoryUsage Usage = MemoryUsage::GpuOnly;
+		bool Dedicated = false; // force a dedicated vk::DeviceMemory
+	};
+
+
+	struct VKAllocation
+	{
+		vk::DeviceMemory Memory = nullptr;
+		vk::DeviceSize Offset = 0;
+		vk::DeviceSize Size = 0;        // requested size
+		void* Mapped = nullptr;         // host pointer at Offset, nullptr for non host visible memory
+		uint32_t MemoryType = ~0u;
+		VKMemoryBlock* Block = nullptr; // internal, nullptr for dedicated allocations
+
+		bool IsDedicated() const { return Memory && !Block; }
+		explicit operator bool() const { return static_cast<bool>(Memory); }
+	};
+
+
+	// Planned move of an allocation during defragmentation
+	struct VKDefragMove
+	{
+		VKAllocation* Allocation = nullptr; // current location, updated by CommitDefragmentation
+		VKAllocation Destination;           // already reserved
+	};
+
+
+	struct VKMemoryBudget
+	{
+		vk::DeviceSize Usage = 0;      // whole process (or own allocations without VK_EXT_memory_budget)
+		vk::DeviceSize Budget = 0;
+		vk::DeviceSize BlockBytes = 0; // own vk::DeviceMemory (blocks and dedicated)
+		vk::DeviceSize AllocationBytes = 0; // own allocations inside of BlockBytes
+	};
+
+
+	struct VKMemoryStats
+	{
+		uint32_t BlockCount = 0;
+		uint32_t DedicatedCount = 0;
+		uint32_t AllocationCount = 0; // sub-allocations and dedicated allocations
+		vk::DeviceSize BlockBytes = 0;
+		vk::DeviceSize DedicatedBytes = 0;
+		vk::DeviceSize UsedBytes = 0;  // sub-allocated (rounded to the buddy size)
+	};
+
+
+	class VKMemoryAllocator
+	{
+	public:
+		static constexpr vk::DeviceSize MinAllocationSize = 256;
+
+		explicit VKMemoryAllocator(const VKDeviceManager& deviceManager);
+		~VKMemoryAllocator();
+
+		// Prevent copying and moving
+		VKMemoryAllocator(const VKMemoryAllocator&) = delete;
+		VKMemoryAllocator& operator=(const VKMemoryAllocator&) = delete;
+		VKMemoryAllocator(VKMemoryAllocator&&) = delete;
+		VKMemoryAllocator& operator=(VKMemoryAllocator&&) = delete;
+
+		// Allocate and bind memory for a resource (uses VkMemoryDedicatedRequirements), throws on failure
+		VKAllocation AllocateForBuffer(vk::Buffer buffer, const VKAllocationInfo& info);
+		VKAllocation AllocateForImage(vk::Image image, const VKAllocationInfo& info);
+
+		// Raw allocation, optimalImage selects the pool for optimal-tiling images
+		VKAllocation Allocate(const vk::MemoryRequirements& requirements, const VKAllocationInfo& info, bool optimalImage = false);
+		void Free(VKAllocation& allocation);
+
+		// Needed for memory without eHostCoherent (no-ops otherwise), size VK_WHOLE_SIZE = rest of the allocation
+		void Flush(const VKAllocation& allocation, vk::DeviceSize offset = 0, vk::DeviceSize size = VK_WHOLE_SIZE) const;
+		void Invalidate(const VKAllocation& allocation, vk::DeviceSize offset = 0, vk::DeviceSize size = VK_WHOLE_SIZE) const;
+
+		// Memory type for the usage, UINT32_MAX if none matches typeFilter
+		uint32_t FindMemoryType(uint32_t typeFilter, MemoryUsage usage) const;
+
+		// --- Defragmentation ---
+		// Reserves new places in fuller blocks for allocations living in sparsely used ones (up to maxBytes).
+		// Then the caller copies the data, recreates/binds its resources to Destination and, once the GPU
+		// no longer uses the old resources, commits (frees the old places) or cancels (frees the new ones).
+		std::vector<VKDefragMove> PlanDefragmentation(const std::vector<VKAllocation*>& allocations, vk::DeviceSize maxBytes = VK_WHOLE_SIZE);
+		void CommitDefragmentation(std::vector<VKDefragMove>& moves);
+		void CancelDefragmentation(std::vector<VKDefragMove>& moves);
+
+		// --- Budget & Stats ---
+		// Queries VK_EXT_memory_budget, call once per frame (e.g. after the frame fence)
+		void UpdateBudget();
+		VKMemoryBudget GetBudget(uint32_t heapIndex) const;
+		VKMemoryStats GetStats() const;
+		void LogStats() const;
+
+		// --- Accessors ---
+		bool HasMemoryBudget() const { return m_hasMemoryBudget; }
+		vk::DeviceSize GetBlockSize() const { return m_blockSize; }
+		vk::DeviceSize GetDedicatedThreshold() const { return m_dedicatedThreshold; } // larger requests are dedicated
+		const vk::PhysicalDeviceMemoryProperties& GetMemoryProperties() const { return m_memoryProperties; }
+
+	private:
+		struct Pool
+		{
+			uint32_t MemoryType = 0;
+			std::vector<Scope<VKMemoryBlock>> Blocks;
+		};
+
+		VKAllocation AllocateInternal(const vk::MemoryRequirements& requirements, const VKAllocationInfo& info, bool optimalImage, bool prefersDedicated, vk::Buffer dedicatedBuffer, vk::Image dedicatedImage);
+		VKAllocation AllocateDedicated(vk::DeviceSize size, uint32_t memoryType, vk::Buffer dedicatedBuffer, vk::Image dedicatedImage);
+		bool AllocateFromBlock(VKMemoryBlock& block, uint32_t order, vk::DeviceSize size, VKAllocation& allocation);
+		VKMemoryBlock* CreateBlock(Pool& pool, uint32_t poolIndex, vk::DeviceSize minSize);
+		void FreeInternal(VKAllocation& allocation);
+		void DestroyBlock(VKMemoryBlock& block);
+		void ReleaseEmptyBlocks(Pool& pool, uint32_t keep);
+		uint32_t GetOrder(vk::DeviceSize size) const;
+		VKMemoryBudget GetBudgetLocked(uint32_t heapIndex) const;
+		void FlushOrInvalidate(const VKAllocation& allocation, vk::DeviceSize offset, vk::DeviceSize size, bool flush) const;
+
+	private:
+		vk::PhysicalDeviceMemoryProperties m_memoryProperties;
+		vk::DeviceSize m_blockSize = 0;          // power of two
+		vk::DeviceSize m_dedicatedThreshold = 0;
+		vk::DeviceSize m_nonCoherentAtomSize = 1;
+		uint32_t m_maxOrder = 0;                 // order of m_blockSize
+		bool m_hasMemoryBudget = false;
+
+		// Two pools per memory type: [type * 2 + 0] buffers/linear, [type * 2 + 1] optimal images
+		std::vector<Pool> m_pools;
+
+		// Per heap
+		std::vector<vk::DeviceSize> m_heapBlockBytes;
+		std::vector<vk::DeviceSize> m_heapAllocationBytes;
+		std::vector<vk::DeviceSize> m_heapBlockBytesAtUpdate; // own block bytes when the budget was queried
+		std::vector<vk::DeviceSize> m_heapUsage;              // as reported by the driver
+		std::vector<vk::DeviceSize> m_heapBudget;
+
+		uint32_t m_dedicatedCount = 0;
+		vk::DeviceSize m_dedicatedBytes = 0;
+
+		mutable std::mutex m_mutex;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,179 @@
+//==============================================================================
+// Vulkan Offscreen Render Target (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Further information in the corresponding header file VKOffscreenTarget.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKOffscreenTarget.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	VKOffscreenTarget::VKOffscreenTarget(const VKDeviceManager& deviceManager, const vk::Extent2D& extent, uint32_t imageCount, vk::Format format)
+		: m_imageFormat(format), m_extent(extent), m_deviceManager(deviceManager)
+	{
+		CreateImages(std::max(imageCount, 1u));
+		CreateImageViews();
+	}
+
+
+	VKOffscreenTarget::~VKOffscreenTarget()
+	{
+		Cleanup();
+	}
+
+
+	void VKOffscreenTarget::Cleanup()
+	{
+		if (!m_framebuffers.empty()) {
+			m_framebuffers.clear();
+			LOG_RENDER_DEBUG("VKOffscreenTarget: Framebuffers destroyed.");
+		}
+
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		for (auto imageView : m_imageViews)
+			logicalDevice.destroyImageView(imageView);
+		m_imageViews.clear();
+
+		for (auto image : m_images)
+			logicalDevice.destroyImage(image);
+		m_images.clear();
+
+		for (auto& memory : m_imageMemory)
+			m_deviceManager.GetMemoryAllocator().Free(memory);
+		m_imageMemory.clear();
+
+		LOG_RENDER_DEBUG("VKOffscreenTarget: Images destroyed.");
+	}
+
+
+	void VKOffscreenTarget::CreateFramebuffers(const vk::RenderPass& renderPass)
+	{
+		m_framebuffers.resize(m_imageViews.size());
+
+		for (size_t i = 0; i < m_imageViews.size(); i++) {
+			std::vector<vk::ImageView> attachments = { m_imageViews[i] };
+			m_framebuffers[i] = CreateScope<VKFramebuffer>(m_deviceManager, renderPass, attachments, m_extent);
+		}
+	}
+
+
+	void VKOffscreenTarget::CreateImages(uint32_t imageCount)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		vk::ImageCreateInfo imageInfo = vk::ImageCreateInfo()
+			.setImageType(vk::ImageType::e2D)
+			.setFormat(m_imageFormat)
+			.setExtent({ m_extent.width, m_extent.height, 1 })
+			.setMipLevels(1)
+			.setArrayLayers(1)
+			.setSamples(vk::SampleCountFlagBits::e1)
+			.setTiling(vk::ImageTiling::eOptimal)
+			.setUsage(vk::ImageUsageFlagBits::eColorAttachment | vk::ImageUsageFlagBits::eTransferSrc)
+			.setSharingMode(vk::SharingMode::eExclusive)
+			.setInitialLayout(vk::ImageLayout::eUndefined);
+
+		m_images.resize(imageCount);
+		m_imageMemory.resize(imageCount);
+		for (uint32_t i = 0; i < imageCount; i++) {
+			m_images[i] = logicalDevice.createImage(imageInfo);
+
+			m_imageMemory[i] = m_deviceManager.GetMemoryAllocator().AllocateForImage(m_images[i], { MemoryUsage::GpuOnly });
+		}
+		LOG_RENDER_DEBUG("VKOffscreenTarget: {} image(s) created ({}x{}, {}).", imageCount, m_extent.width, m_extent.height, vk::to_string(m_imageFormat));
+	}
+
+
+	void VKOffscreenTarget::CreateImageViews()
+	{
+		m_imageViews.resize(m_images.size());
+
+		vk::ImageSubresourceRange subresourceRange = vk::ImageSubresourceRange()
+			.setAspectMask(vk::ImageAspectFlagBits::eColor)
+			.setBaseMipLevel(0)
+			.setLevelCount(1)
+			.setBaseArrayLayer(0)
+			.setLayerCount(1);
+
+		for (size_t i = 0; i < m_images.size(); i++) {
+			vk::ImageViewCreateInfo createInfo = vk::ImageViewCreateInfo()
+				.setImage(m_images[i])
+				.setViewType(vk::ImageViewType::e2D)
+				.setFormat(m_imageFormat)
+				.setSubresourceRange(subresourceRange);
+			m_imageViews[i] = m_deviceManager.GetLogicalDevice().createImageView(createInfo);
+		}
+		LOG_RENDER_DEBUG("VKOffscreenTarget: ImageViews created.");
+	}
+
+
+	bool VKOffscreenTarget::Readback(const vk::CommandPool& commandPool, const vk::Queue& queue, uint32_t index, std::vector<uint8_t>& pixels) const
+	{
+		if (index >= m_images.size())
+			return false;
+
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		const vk::DeviceSize size = static_cast<vk::DeviceSize>(m_extent.width) * m_extent.height * 4;
+
+		// Host visible staging buffer
+		vk::BufferCreateInfo bufferInfo = vk::BufferCreateInfo()
+			.setSize(size)
+			.setUsage(vk::BufferUsageFlagBits::eTransferDst)
+			.setSharingMode(vk::SharingMode::eExclusive);
+		vk::Buffer buffer = logicalDevice.createBuffer(bufferInfo);
+
+		VKMemoryAllocator& allocator = m_deviceManager.GetMemoryAllocator();
+		VKAllocation memory = allocator.AllocateForBuffer(buffer, { MemoryUsage::Readback });
+
+		// One-time copy
+		vk::CommandBufferAllocateInfo cmdInfo = vk::CommandBufferAllocateInfo()
+			.setCommandPool(commandPool)
+			.setLevel(vk::CommandBufferLevel::ePrimary)
+			.setCommandBufferCount(1);
+		vk::CommandBuffer commandBuffer = logicalDevice.allocateCommandBuffers(cmdInfo)[0];
+
+		commandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+		vk::BufferImageCopy region = vk::BufferImageCopy()
+			.setBufferOffset(0)
+			.setBufferRowLength(0)
+			.setBufferImageHeight(0)
+			.setImageSubresource({ vk::ImageAspectFlagBits::eColor, 0, 0, 1 })
+			.setImageOffset({ 0, 0, 0 })
+			.setImageExtent({ m_extent.width, m_extent.height, 1 });
+		commandBuffer.copyImageToBuffer(m_images[index], vk::ImageLayout::eTransferSrcOptimal, buffer, { region });
+
+		// Make the copy available to the host read below
+		vk::BufferMemoryBarrier barrier = vk::BufferMemoryBarrier()
+			.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+			.setDstAccessMask(vk::AccessFlagBits::eHostRead)
+			.setSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+			.setDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED)
+			.setBuffer(buffer)
+			.setOffset(0)
+			.setSize(size);
+		commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost, {}, {}, { barrier }, {});
+		commandBuffer.end();
+
+		queue.submit({ vk::SubmitInfo().setCommandBufferCount(1).setPCommandBuffers(&commandBuffer) }, nullptr);
+		queue.waitIdle();
+
+		// Non-coherent readback memory needs an invalidate before the mapped read
+		pixels.resize(static_cast<size_t>(size));
+		allocator.Invalidate(memory);
+		std::memcpy(pixels.data(), memory.Mapped, static_cast<size_t>(size));
+
+		logicalDevice.freeCommandBuffers(commandPool, { commandBuffer });
+		logicalDevice.destroyBuffer(buffer);
+		allocator.Free(memory);
+		return true;
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
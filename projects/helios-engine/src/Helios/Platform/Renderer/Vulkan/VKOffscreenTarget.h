@@ -0,0 +1,84 @@
+//==============================================================================
+// Vulkan Offscreen Render Target
+//
+// Stands in for the swapchain when rendering headless (no window, no surface).
+// Owns a fixed set of device-local color images with views and framebuffers
+// that the renderer cycles through like swapchain images, and can copy an
+// image back to host memory for inspection (e.g. golden image tests in CI).
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Color images usable as attachment and transfer source.
+// - Accessors mirroring VKSwapchain (images, views, framebuffers, format, extent).
+// - Synchronous readback of a rendered image to tightly packed RGBA8 pixels.
+//
+// Notes:
+// - Images are expected in eTransferSrcOptimal after rendering (render pass
+//   final layout), Readback relies on that and on the render pass's outgoing
+//   dependency (color attachment write -> transfer read) for the copy.
+// - The copy is made visible to the host with a transfer write -> host read
+//   barrier, and the mapped memory is invalidated before it is read.
+//
+// Changelog:
+// - 2026.10: Readback makes the copy visible to the host (barrier, invalidate)
+// - 2026.10: Image and readback memory from the VKMemoryAllocator
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Platform/Renderer/Vulkan/VKFramebuffer.h"
+#include "Helios/Platform/Renderer/Vulkan/VKMemoryAllocator.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	class VKOffscreenTarget
+	{
+	public:
+		VKOffscreenTarget(const VKDeviceManager& deviceManager, const vk::Extent2D& extent, uint32_t imageCount, vk::Format format = vk::Format::eR8G8B8A8Unorm);
+		~VKOffscreenTarget();
+
+		// Prevent copying and moving
+		VKOffscreenTarget(const VKOffscreenTarget&) = delete;
+		VKOffscreenTarget& operator=(const VKOffscreenTarget&) = delete;
+		VKOffscreenTarget(VKOffscreenTarget&&) = delete;
+		VKOffscreenTarget& operator=(VKOffscreenTarget&&) = delete;
+
+		void CreateFramebuffers(const vk::RenderPass& renderPass);
+
+		// Copies image 'index' into pixels (width * height * 4 bytes, RGBA8).
+		// Blocks until the copy is done, the image must not be in use by the GPU.
+		bool Readback(const vk::CommandPool& commandPool, const vk::Queue& queue, uint32_t index, std::vector<uint8_t>& pixels) const;
+
+		// --- Accessors ---
+		const std::vector<vk::Image>& GetImages() const { return m_images; }
+		const std::vector<vk::ImageView>& GetImageViews() const { return m_imageViews; }
+		uint32_t GetImageCount() const { return static_cast<uint32_t>(m_images.size()); }
+		const vk::Format& GetImageFormat() const { return m_imageFormat; }
+		const vk::Extent2D& GetExtent() const { return m_extent; }
+		const std::vector<Scope<VKFramebuffer>>& GetFramebuffers() const { return m_framebuffers; }
+
+	private:
+		void CreateImages(uint32_t imageCount);
+		void CreateImageViews();
+		void Cleanup();
+
+	private:
+		std::vector<vk::Image> m_images;
+		std::vector<VKAllocation> m_imageMemory;
+		std::vector<vk::ImageView> m_imageViews;
+		std::vector<Scope<VKFramebuffer>> m_framebuffers;
+		vk::Format m_imageFormat;
+		vk::Extent2D m_extent;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
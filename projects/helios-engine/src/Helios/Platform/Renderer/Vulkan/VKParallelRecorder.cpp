@@ -0,0 +1,81 @@
+//==============================================================================
+// Vulkan Parallel Recorder (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKParallelRecorder.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKParallelRecorder.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	VKParallelRecorder::VKParallelRecorder(const VKDeviceManager& deviceManager, uint32_t framesInFlight, uint32_t slotCount)
+		: m_slotCount(std::max(slotCount, 1u)), m_deviceManager(deviceManager)
+	{
+		// Transient: the buffers live for one frame, the whole pool is reset afterwards
+		vk::CommandPoolCreateInfo poolInfo = vk::CommandPoolCreateInfo()
+			.setFlags(vk::CommandPoolCreateFlagBits::eTransient)
+			.setQueueFamilyIndex(m_deviceManager.GetGraphicsQueueIndex());
+
+		m_pools.resize(static_cast<size_t>(std::max(framesInFlight, 1u)) * m_slotCount);
+		for (auto& pool : m_pools)
+			pool.Pool = m_deviceManager.GetLogicalDevice().createCommandPool(poolInfo);
+
+		LOG_RENDER_DEBUG("VKParallelRecorder: Created ({} slot(s) per frame, {} command pools).", m_slotCount, m_pools.size());
+	}
+
+
+	VKParallelRecorder::~VKParallelRecorder()
+	{
+		// Destroying a pool frees its command buffers
+		for (auto& pool : m_pools)
+			m_deviceManager.GetLogicalDevice().destroyCommandPool(pool.Pool);
+		m_pools.clear();
+		LOG_RENDER_DEBUG("VKParallelRecorder: Destroyed.");
+	}
+
+
+	void VKParallelRecorder::BeginFrame(uint32_t frame)
+	{
+		m_currentFrame = frame % static_cast<uint32_t>(m_pools.size() / m_slotCount);
+		m_recorded.clear();
+
+		// One reset per pool returns all of its secondaries to the initial state
+		for (uint32_t slot = 0; slot < m_slotCount; slot++) {
+			SlotPool& pool = m_pools[m_currentFrame * m_slotCount + slot];
+			if (pool.Used == 0)
+				continue;
+			m_deviceManager.GetLogicalDevice().resetCommandPool(pool.Pool);
+			pool.Used = 0;
+		}
+	}
+
+
+	vk::CommandBuffer VKParallelRecorder::BeginSecondary(uint32_t slot, const vk::CommandBufferInheritanceInfo& inheritance)
+	{
+		SlotPool& pool = m_pools[m_currentFrame * m_slotCount + slot];
+		if (pool.Used == pool.Buffers.size()) {
+			vk::CommandBufferAllocateInfo allocInfo = vk::CommandBufferAllocateInfo()
+				.setCommandPool(pool.Pool)
+				.setLevel(vk::CommandBufferLevel::eSecondary)
+				.setCommandBufferCount(1);
+			pool.Buffers.push_back(m_deviceManager.GetLogicalDevice().allocateCommandBuffers(allocInfo)[0]);
+		}
+
+		vk::CommandBuffer commandBuffer = pool.Buffers[pool.Used++];
+		vk::CommandBufferUsageFlags flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit;
+		if (inheritance.renderPass)
+			flags |= vk::CommandBufferUsageFlagBits::eRenderPassContinue;
+		commandBuffer.begin(vk::CommandBufferBeginInfo()
+			.setFlags(flags)
+			.setPInheritanceInfo(&inheritance));
+		return commandBuffer;
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,115 @@
+//==============================================================================
+// Vulkan Parallel Recorder
+//
+// Records secondary command buffers on the job system. Every frame in flight
+// has one command pool per recording slot; a slot is used by exactly one job
+// at a time, so pools never need a lock. The renderer executes the recorded
+// secondaries in the primary command buffer at EndFrame, in chunk order.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Pools per frame in flight and slot, reset as a whole in BeginFrame (after
+//   the frame's fence) instead of per command buffer.
+// - Secondary command buffers are allocated once and reused every frame.
+// - Record(): one job per chunk, results in deterministic chunk order no
+//   matter which thread recorded them. Runs inline without a job system.
+//
+// Notes:
+// - Slots are not tied to threads: a Wait() that helps with other jobs could
+//   run two chunks on one thread, or any thread could pick up a chunk. One
+//   chunk per slot keeps every pool single-threaded.
+// - Secondaries continue the render pass given in the inheritance info; no
+//   state is inherited, every chunk binds its own pipeline and buffers.
+//
+// Usage:
+//   recorder.BeginFrame(frame);                        // after the fence wait
+//   recorder.Record(chunks, inheritance, [&](vk::CommandBuffer cmd, uint32_t chunk) { ... });
+//   primary.executeCommands(recorder.GetRecorded());   // inside the render pass
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Engine/Core/JobSystem.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	class VKParallelRecorder
+	{
+	public:
+		VKParallelRecorder(const VKDeviceManager& deviceManager, uint32_t framesInFlight, uint32_t slotCount);
+		~VKParallelRecorder();
+
+		// Prevent copying and moving
+		VKParallelRecorder(const VKParallelRecorder&) = delete;
+		VKParallelRecorder& operator=(const VKParallelRecorder&) = delete;
+		VKParallelRecorder(VKParallelRecorder&&) = delete;
+		VKParallelRecorder& operator=(VKParallelRecorder&&) = delete;
+
+		// Call after the fence of 'frame' was waited for, resets its pools and the recorded list
+		void BeginFrame(uint32_t frame);
+
+		// fn(commandBuffer, chunk) for chunk in [0, chunkCount), chunkCount <= GetSlotCount().
+		// The command buffers are begun and ended here and appended to GetRecorded() in chunk order.
+		template<typename Fn>
+		void Record(uint32_t chunkCount, const vk::CommandBufferInheritanceInfo& inheritance, Fn&& fn);
+
+		// --- Accessors ---
+		uint32_t GetSlotCount() const { return m_slotCount; }
+		const std::vector<vk::CommandBuffer>& GetRecorded() const { return m_recorded; }
+
+	private:
+		struct SlotPool
+		{
+			vk::CommandPool Pool;
+			std::vector<vk::CommandBuffer> Buffers; // allocated so far, reused after the pool reset
+			uint32_t Used = 0;
+		};
+
+		// Next secondary of 'slot' in the current frame, begun with the inheritance info
+		vk::CommandBuffer BeginSecondary(uint32_t slot, const vk::CommandBufferInheritanceInfo& inheritance);
+
+	private:
+		std::vector<SlotPool> m_pools; // [frame * slotCount + slot]
+		uint32_t m_slotCount = 0;
+		uint32_t m_currentFrame = 0;
+		std::vector<vk::CommandBuffer> m_recorded;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+	template<typename Fn>
+	void VKParallelRecorder::Record(uint32_t chunkCount, const vk::CommandBufferInheritanceInfo& inheritance, Fn&& fn)
+	{
+		chunkCount = std::min(chunkCount, m_slotCount);
+		const size_t first = m_recorded.size();
+		m_recorded.resize(first + chunkCount);
+
+		auto record = [&](uint32_t chunk) {
+			vk::CommandBuffer commandBuffer = BeginSecondary(chunk, inheritance);
+			fn(commandBuffer, chunk);
+			commandBuffer.end();
+			m_recorded[first + chunk] = commandBuffer;
+		};
+
+		JobSystem* jobs = JobSystem::Get();
+		if (jobs && chunkCount > 1) {
+			jobs->ParallelFor(chunkCount, 1, record);
+		}
+		else {
+			for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+				record(chunk);
+		}
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -9,7 +9,9 @@
 #include "pch.h"
 #include "VKPipeline.h"
 
-#include "Helios/Engine/VFS/VFS.h"
+#include "Helios/Engine/Util/Hash.h"
+
+#include <cstring>
 
 namespace Helios::Engine::Renderer::Vulkan {
 
@@ -41,12 +43,15 @@ namespace Helios::Engine::Renderer::Vulkan {
 			.setBasePipelineHandle(nullptr)
 			.setBasePipelineIndex(-1);
 
-		auto result = m_deviceManager.GetLogicalDevice().createGraphicsPipeline(nullptr, pipelineInfo);
+		uint64_t createBegin = Clock::Now();
+		auto result = m_deviceManager.GetLogicalDevice().createGraphicsPipeline(builder.m_pipelineCache.Get(), pipelineInfo);
+		uint64_t createTicks = Clock::Now() - createBegin;
 		if (result.result != vk::Result::eSuccess) {
 			LOG_RENDER_EXCEPT("VKPipeline: Failed to create graphics pipeline!");
 		}
 		m_pipeline = result.value;
-		LOG_RENDER_DEBUG("VKPipeline: Graphics pipeline created.");
+		builder.m_pipelineCache.RecordPipelineCreation(createTicks);
+		LOG_RENDER_DEBUG("VKPipeline: Graphics pipeline created ({:.3f} ms).", Clock::TicksToMilliseconds(createTicks));
 	}
 
 
@@ -69,8 +74,8 @@ namespace Helios::Engine::Renderer::Vulkan {
 	// VKPipelineBuilder Implementation
 	//------------------------------------------------------------------------------
 
-	VKPipelineBuilder::VKPipelineBuilder(const VKDeviceManager& deviceManager, const VKRenderPass& renderPass)
-		: m_deviceManager(deviceManager), m_renderPass(renderPass)
+	VKPipelineBuilder::VKPipelineBuilder(const VKDeviceManager& deviceManager, const VKRenderPass& renderPass, VKPipelineCache& pipelineCache, VKShaderCache& shaderCache)
+		: m_deviceManager(deviceManager), m_renderPass(renderPass), m_pipelineCache(pipelineCache), m_shaderCache(shaderCache)
 	{
 		// Default states
 		m_inputAssembly = vk::PipelineInputAssemblyStateCreateInfo()
@@ -106,32 +111,24 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	VKPipelineBuilder::~VKPipelineBuilder()
-	{
-		for (auto& shaderStage : m_shaderStages) {
-			if (shaderStage.module) {
-				m_deviceManager.GetLogicalDevice().destroyShaderModule(shaderStage.module);
-			}
-		}
-	}
-
-
 	VKPipelineBuilder& VKPipelineBuilder::SetShaders(const std::string& vertPath, const std::string& fragPath)
 	{
-		vk::ShaderModule vertShaderModule = CreateShaderModule(vertPath);
-		vk::ShaderModule fragShaderModule = CreateShaderModule(fragPath);
+		// Modules are owned by the shader cache and shared between builds
+		VKShaderModuleInfo vertShader = m_shaderCache.GetModule(vertPath);
+		VKShaderModuleInfo fragShader = m_shaderCache.GetModule(fragPath);
 
 		vk::PipelineShaderStageCreateInfo vertShaderStageInfo = vk::PipelineShaderStageCreateInfo()
 			.setStage(vk::ShaderStageFlagBits::eVertex)
-			.setModule(vertShaderModule)
+			.setModule(vertShader.Module)
 			.setPName("main");
 
 		vk::PipelineShaderStageCreateInfo fragShaderStageInfo = vk::PipelineShaderStageCreateInfo()
 			.setStage(vk::ShaderStageFlagBits::eFragment)
-			.setModule(fragShaderModule)
+			.setModule(fragShader.Module)
 			.setPName("main");
 
 		m_shaderStages = { vertShaderStageInfo, fragShaderStageInfo };
+		m_shaderHashes = { vertShader.Hash, fragShader.Hash };
 		return *this;
 	}
 
@@ -156,14 +153,16 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 	VKPipelineBuilder& VKPipelineBuilder::SetViewport(const vk::Viewport& viewport)
 	{
-		m_viewportState.setPViewports(&viewport);
+		m_viewport = viewport;
+		m_viewportState.setPViewports(&m_viewport);
 		return *this;
 	}
 
 
 	VKPipelineBuilder& VKPipelineBuilder::SetScissor(const vk::Rect2D& scissor)
 	{
-		m_viewportState.setPScissors(&scissor);
+		m_scissor = scissor;
+		m_viewportState.setPScissors(&m_scissor);
 		return *this;
 	}
 
@@ -216,6 +215,13 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
+	VKPipelineBuilder& VKPipelineBuilder::SetDescriptorSetLayouts(const std::vector<vk::DescriptorSetLayout>& setLayouts)
+	{
+		m_setLayouts = setLayouts;
+		return *this;
+	}
+
+
 	Scope<VKPipeline> VKPipelineBuilder::Build()
 	{
 		m_vertexInputInfo = vk::PipelineVertexInputStateCreateInfo()
@@ -232,26 +238,131 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		m_pipelineLayoutInfo.setPushConstantRangeCount(static_cast<uint32_t>(m_pushConstantRanges.size()));
 		m_pipelineLayoutInfo.setPPushConstantRanges(m_pushConstantRanges.data());
+		m_pipelineLayoutInfo.setSetLayoutCount(static_cast<uint32_t>(m_setLayouts.size()));
+		m_pipelineLayoutInfo.setPSetLayouts(m_setLayouts.data());
 
 		return CreateScope<VKPipeline>(m_deviceManager, *this);
 	}
 
 
-	vk::ShaderModule VKPipelineBuilder::CreateShaderModule(const std::string& path)
+	uint64_t VKPipelineBuilder::ComputeHash() const
 	{
-		auto shaderBinary = VirtFS.ReadBinary(path);
-		if (shaderBinary.empty()) {
-			LOG_RENDER_EXCEPT("VKPipeline: Failed to load shader: '{}'", path);
+		// Hashes the fields that reach the driver, the create-info structs also
+		// hold pointers and padding
+		uint64_t hash = 0;
+		auto mix = [&hash](uint64_t value) { hash = Util::HashCombine(hash, value); };
+		auto mixFloat = [&mix](float value) { uint32_t bits; std::memcpy(&bits, &value, sizeof(bits)); mix(bits); };
+
+		// Shaders
+		mix(m_shaderStages.size());
+		for (size_t i = 0; i < m_shaderStages.size(); ++i) {
+			mix(static_cast<uint64_t>(m_shaderStages[i].stage));
+			mix(i < m_shaderHashes.size() ? m_shaderHashes[i] : 0);
+			mix(Util::HashFnv1a(m_shaderStages[i].pName ? m_shaderStages[i].pName : ""));
+		}
+
+		// Vertex input
+		mix(m_bindingDescriptions.size());
+		for (const auto& binding : m_bindingDescriptions) {
+			mix(binding.binding);
+			mix(binding.stride);
+			mix(static_cast<uint64_t>(binding.inputRate));
+		}
+		mix(m_attributeDescriptions.size());
+		for (const auto& attribute : m_attributeDescriptions) {
+			mix(attribute.location);
+			mix(attribute.binding);
+			mix(static_cast<uint64_t>(attribute.format));
+			mix(attribute.offset);
+		}
+
+		// Input assembly
+		mix(static_cast<uint64_t>(m_inputAssembly.topology));
+		mix(m_inputAssembly.primitiveRestartEnable);
+
+		// Viewport/scissor (only relevant if not dynamic, cheap enough to always include)
+		mixFloat(m_viewport.x); mixFloat(m_viewport.y);
+		mixFloat(m_viewport.width); mixFloat(m_viewport.height);
+		mixFloat(m_viewport.minDepth); mixFloat(m_viewport.maxDepth);
+		mix(static_cast<uint32_t>(m_scissor.offset.x)); mix(static_cast<uint32_t>(m_scissor.offset.y));
+		mix(m_scissor.extent.width); mix(m_scissor.extent.height);
+
+		// Rasterizer
+		mix(m_rasterizer.depthClampEnable);
+		mix(m_rasterizer.rasterizerDiscardEnable);
+		mix(static_cast<uint64_t>(m_rasterizer.polygonMode));
+		mix(static_cast<uint32_t>(m_rasterizer.cullMode));
+		mix(static_cast<uint64_t>(m_rasterizer.frontFace));
+		mix(m_rasterizer.depthBiasEnable);
+		mixFloat(m_rasterizer.depthBiasConstantFactor);
+		mixFloat(m_rasterizer.depthBiasClamp);
+		mixFloat(m_rasterizer.depthBiasSlopeFactor);
+		mixFloat(m_rasterizer.lineWidth);
+
+		// Multisampling
+		mix(static_cast<uint64_t>(m_multisampling.rasterizationSamples));
+		mix(m_multisampling.sampleShadingEnable);
+		mixFloat(m_multisampling.minSampleShading);
+		mix(m_multisampling.alphaToCoverageEnable);
+		mix(m_multisampling.alphaToOneEnable);
+
+		// Color blending
+		mix(m_colorBlending.logicOpEnable);
+		mix(static_cast<uint64_t>(m_colorBlending.logicOp));
+		for (float constant : m_colorBlending.blendConstants)
+			mixFloat(constant);
+		mix(m_colorBlendAttachments.size());
+		for (const auto& attachment : m_colorBlendAttachments) {
+			mix(attachment.blendEnable);
+			mix(static_cast<uint64_t>(attachment.srcColorBlendFactor));
+			mix(static_cast<uint64_t>(attachment.dstColorBlendFactor));
+			mix(static_cast<uint64_t>(attachment.colorBlendOp));
+			mix(static_cast<uint64_t>(attachment.srcAlphaBlendFactor));
+			mix(static_cast<uint64_t>(attachment.dstAlphaBlendFactor));
+			mix(static_cast<uint64_t>(attachment.alphaBlendOp));
+			mix(static_cast<uint32_t>(attachment.colorWriteMask));
+		}
+
+		// Depth/stencil
+		mix(m_depthStencil.depthTestEnable);
+		mix(m_depthStencil.depthWriteEnable);
+		mix(static_cast<uint64_t>(m_depthStencil.depthCompareOp));
+		mix(m_depthStencil.depthBoundsTestEnable);
+		mix(m_depthStencil.stencilTestEnable);
+		for (const vk::StencilOpState& op : { m_depthStencil.front, m_depthStencil.back }) {
+			mix(static_cast<uint64_t>(op.failOp));
+			mix(static_cast<uint64_t>(op.passOp));
+			mix(static_cast<uint64_t>(op.depthFailOp));
+			mix(static_cast<uint64_t>(op.compareOp));
+			mix(op.compareMask);
+			mix(op.writeMask);
+			mix(op.reference);
+		}
+		mixFloat(m_depthStencil.minDepthBounds);
+		mixFloat(m_depthStencil.maxDepthBounds);
+
+		// Dynamic state
+		mix(m_dynamicStates.size());
+		for (vk::DynamicState state : m_dynamicStates)
+			mix(static_cast<uint64_t>(state));
+
+		// Layout
+		mix(m_pushConstantRanges.size());
+		for (const auto& range : m_pushConstantRanges) {
+			mix(static_cast<uint32_t>(range.stageFlags));
+			mix(range.offset);
+			mix(range.size);
 		}
-		std::vector<char> code(shaderBinary.begin(), shaderBinary.end());
+		// Layout handles live as long as their owner (e.g. the bindless heap), enough for in-process keys
+		mix(m_setLayouts.size());
+		for (vk::DescriptorSetLayout setLayout : m_setLayouts)
+			mix(reinterpret_cast<uint64_t>(static_cast<VkDescriptorSetLayout>(setLayout)));
 
-		vk::ShaderModuleCreateInfo createInfo = vk::ShaderModuleCreateInfo()
-			.setCodeSize(code.size())
-			.setPCode(reinterpret_cast<const uint32_t*>(code.data()));
+		// Render pass (compatible passes share pipelines), subpass 0
+		mix(m_renderPass.GetCompatibilityHash());
+		mix(0);
 
-		vk::ShaderModule shaderModule = m_deviceManager.GetLogicalDevice().createShaderModule(createInfo);
-		LOG_RENDER_DEBUG("VKPipeline: Shader module created for '{}'.", path);
-		return shaderModule;
+		return hash;
 	}
 
 
@@ -12,15 +12,23 @@
 // - `VKPipeline`: RAII wrapper for `vk::Pipeline` and `vk::PipelineLayout`.
 // - `VKPipelineBuilder`: A builder pattern for constructing graphics pipelines.
 // - Configures all programmable and fixed-function stages.
-// - Handles shader module creation from SPIR-V code.
+// - Shader modules come from the renderer's VKShaderCache (SPIR-V or GLSL).
+// - Pipelines are created through the renderer's VKPipelineCache.
 //
 // Changelog:
+// - 2026.10: Added SetDescriptorSetLayouts
+// - 2026.10: Shader modules are taken from a VKShaderCache instead of being created per build
+// - 2026.10: Added ComputeHash (full state key for VKPipelineLibrary), viewport/scissor
+//            are copied so a builder can outlive the caller's stack (async builds)
+// - 2026.10: Builds go through a VKPipelineCache (persistent, creation time stats)
 // - 2026.01: Initial version
 //==============================================================================
 #pragma once
 
 #include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
 #include "Helios/Platform/Renderer/Vulkan/VKRenderPass.h"
+#include "Helios/Platform/Renderer/Vulkan/VKPipelineCache.h"
+#include "Helios/Platform/Renderer/Vulkan/VKShaderCache.h"
 
 namespace Helios::Engine::Renderer::Vulkan {
 
@@ -56,9 +64,10 @@ namespace Helios::Engine::Renderer::Vulkan {
 	class VKPipelineBuilder
 	{
 	public:
-		VKPipelineBuilder(const VKDeviceManager& deviceManager, const VKRenderPass& renderPass);
-		~VKPipelineBuilder();
+		VKPipelineBuilder(const VKDeviceManager& deviceManager, const VKRenderPass& renderPass, VKPipelineCache& pipelineCache, VKShaderCache& shaderCache);
+		~VKPipelineBuilder() = default;
 
+		// SPIR-V (*.spv) or GLSL (*.vert.glsl, *.frag.glsl) paths
 		VKPipelineBuilder& SetShaders(const std::string& vertPath, const std::string& fragPath);
 		VKPipelineBuilder& SetVertexInput(
 			const std::vector<vk::VertexInputBindingDescription>& bindingDescriptions,
@@ -72,16 +81,21 @@ namespace Helios::Engine::Renderer::Vulkan {
 		VKPipelineBuilder& SetDepthStencil(vk::Bool32 depthTestEnable, vk::Bool32 depthWriteEnable, vk::CompareOp depthCompareOp);
 		VKPipelineBuilder& SetDynamicState(const std::vector<vk::DynamicState>& dynamicStates);
 		VKPipelineBuilder& SetPushConstantRanges(const std::vector<vk::PushConstantRange>& pushConstantRanges);
+		VKPipelineBuilder& SetDescriptorSetLayouts(const std::vector<vk::DescriptorSetLayout>& setLayouts);
 
 		Scope<VKPipeline> Build();
 
+		// Hash of the complete pipeline state (shader code, fixed-function state,
+		// layout and render pass compatibility), equal states compile to equal pipelines
+		uint64_t ComputeHash() const;
+
 	private:
 		friend class VKPipeline;
 
-		vk::ShaderModule CreateShaderModule(const std::string& path);
-
 		const VKDeviceManager& m_deviceManager;
 		const VKRenderPass& m_renderPass;
+		VKPipelineCache& m_pipelineCache;
+		VKShaderCache& m_shaderCache;
 
 		std::vector<vk::PipelineShaderStageCreateInfo> m_shaderStages;
 		vk::PipelineVertexInputStateCreateInfo m_vertexInputInfo;
@@ -93,12 +107,16 @@ namespace Helios::Engine::Renderer::Vulkan {
 		vk::PipelineDepthStencilStateCreateInfo m_depthStencil;
 		vk::PipelineDynamicStateCreateInfo m_dynamicState;
 		vk::PipelineLayoutCreateInfo m_pipelineLayoutInfo;
+		vk::Viewport m_viewport;
+		vk::Rect2D m_scissor;
+		std::vector<uint64_t> m_shaderHashes; // content hash per stage, same order as m_shaderStages
 
 		std::vector<vk::VertexInputBindingDescription> m_bindingDescriptions;
 		std::vector<vk::VertexInputAttributeDescription> m_attributeDescriptions;
 		std::vector<vk::PipelineColorBlendAttachmentState> m_colorBlendAttachments;
 		std::vector<vk::DynamicState> m_dynamicStates;
 		std::vector<vk::PushConstantRange> m_pushConstantRanges;
+		std::vector<vk::DescriptorSetLayout> m_setLayouts;
 	};
 
 
@@ -0,0 +1,173 @@
+//==============================================================================
+// Vulkan Pipeline Cache (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Further information in the corresponding header file VKPipelineCache.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKPipelineCache.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+#include "Helios/Engine/Util/Hash.h"
+#include "Helios/Engine/VFS/VFS.h"
+
+#include <cstring>
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	VKPipelineCache::VKPipelineCache(const VKDeviceManager& deviceManager, bool persistent)
+		: m_persistent(persistent), m_deviceManager(deviceManager)
+	{
+		m_deviceProperties = m_deviceManager.GetPhysicalDevice().getProperties();
+		m_path = fmt::format("@cache:/vulkan/pipelines_{:04x}_{:04x}.bin", m_deviceProperties.vendorID, m_deviceProperties.deviceID);
+
+		std::vector<uint8_t> initialData;
+		if (m_persistent)
+			initialData = Load();
+
+		vk::PipelineCacheCreateInfo createInfo = vk::PipelineCacheCreateInfo()
+			.setInitialDataSize(initialData.size())
+			.setPInitialData(initialData.empty() ? nullptr : initialData.data());
+
+		try {
+			m_pipelineCache = m_deviceManager.GetLogicalDevice().createPipelineCache(createInfo);
+		}
+		catch (const vk::SystemError& e) {
+			// The header matched, but the driver still rejected the data: start empty
+			LOG_RENDER_WARN("VKPipelineCache: Driver rejected cache data ({}), starting with an empty cache.", e.what());
+			m_loadedBytes = 0;
+			m_coldCreationTime = 0.0;
+			m_pipelineCache = m_deviceManager.GetLogicalDevice().createPipelineCache(vk::PipelineCacheCreateInfo());
+		}
+		LOG_RENDER_DEBUG("VKPipelineCache: Pipeline cache created ({} bytes initial data).", m_loadedBytes);
+	}
+
+
+	VKPipelineCache::~VKPipelineCache()
+	{
+		if (m_pipelineCache) {
+			m_deviceManager.GetLogicalDevice().destroyPipelineCache(m_pipelineCache);
+			m_pipelineCache = nullptr;
+			LOG_RENDER_DEBUG("VKPipelineCache: Pipeline cache destroyed.");
+		}
+	}
+
+
+	std::vector<uint8_t> VKPipelineCache::Load()
+	{
+		HE_PROFILE_FUNCTION();
+
+		if (!VirtFS.Exists(m_path)) {
+			LOG_RENDER_INFO("VKPipelineCache: No cache file '{}', pipelines are compiled from scratch.", m_path);
+			return {};
+		}
+
+		std::vector<uint8_t> file = VirtFS.ReadBinary(m_path);
+		if (file.size() < sizeof(FileHeader)) {
+			LOG_RENDER_WARN("VKPipelineCache: Cache file '{}' is truncated, ignored.", m_path);
+			return {};
+		}
+
+		FileHeader header;
+		std::memcpy(&header, file.data(), sizeof(FileHeader));
+
+		const char* reason = nullptr;
+		if (header.Magic != FILE_MAGIC || header.Version != FILE_VERSION)
+			reason = "unknown format";
+		else if (header.VendorID != m_deviceProperties.vendorID || header.DeviceID != m_deviceProperties.deviceID)
+			reason = "different device";
+		else if (header.DriverVersion != m_deviceProperties.driverVersion)
+			reason = "driver version changed";
+		else if (std::memcmp(header.CacheUUID, m_deviceProperties.pipelineCacheUUID.data(), VK_UUID_SIZE) != 0)
+			reason = "pipeline cache UUID changed";
+		else if (header.DataSize != file.size() - sizeof(FileHeader))
+			reason = "size mismatch";
+		else if (header.DataHash != Util::HashFnv1a(file.data() + sizeof(FileHeader), static_cast<size_t>(header.DataSize)))
+			reason = "hash mismatch";
+
+		if (reason) {
+			LOG_RENDER_INFO("VKPipelineCache: Cache file '{}' discarded ({}).", m_path, reason);
+			return {};
+		}
+
+		m_loadedBytes = static_cast<size_t>(header.DataSize);
+		m_coldCreationTime = header.ColdCreationTime;
+		LOG_RENDER_INFO("VKPipelineCache: Loaded {} KB from '{}'.", m_loadedBytes / 1024, m_path);
+		return std::vector<uint8_t>(file.begin() + sizeof(FileHeader), file.end());
+	}
+
+
+	bool VKPipelineCache::Save()
+	{
+		HE_PROFILE_FUNCTION();
+
+		if (!m_persistent || !m_pipelineCache)
+			return false;
+
+		std::vector<uint8_t> data = m_deviceManager.GetLogicalDevice().getPipelineCacheData(m_pipelineCache);
+		if (data.empty())
+			return false;
+
+		// A cold run measures the time the cache saves on later runs
+		if (!IsWarm() && m_coldCreationTime == 0.0)
+			m_coldCreationTime = GetCreationTime();
+
+		FileHeader header = {};
+		header.Magic = FILE_MAGIC;
+		header.Version = FILE_VERSION;
+		header.VendorID = m_deviceProperties.vendorID;
+		header.DeviceID = m_deviceProperties.deviceID;
+		header.DriverVersion = m_deviceProperties.driverVersion;
+		std::memcpy(header.CacheUUID, m_deviceProperties.pipelineCacheUUID.data(), VK_UUID_SIZE);
+		header.DataSize = data.size();
+		header.DataHash = Util::HashFnv1a(data);
+		header.ColdCreationTime = m_coldCreationTime;
+
+		std::vector<uint8_t> file(sizeof(FileHeader) + data.size());
+		std::memcpy(file.data(), &header, sizeof(FileHeader));
+		std::memcpy(file.data() + sizeof(FileHeader), data.data(), data.size());
+
+		VirtFS.CreateDirectories(VirtFS.GetParentPath(m_path));
+		if (!VirtFS.WriteBinary(m_path, file)) {
+			LOG_RENDER_WARN("VKPipelineCache: Failed to write '{}'.", m_path);
+			return false;
+		}
+		LOG_RENDER_DEBUG("VKPipelineCache: Saved {} KB to '{}'.", data.size() / 1024, m_path);
+		return true;
+	}
+
+
+	void VKPipelineCache::RecordPipelineCreation(uint64_t ticks)
+	{
+		m_pipelineCount.fetch_add(1, std::memory_order_relaxed);
+		m_creationTicks.fetch_add(ticks, std::memory_order_relaxed);
+	}
+
+
+	double VKPipelineCache::GetCreationTime() const
+	{
+		return Clock::TicksToSeconds(m_creationTicks.load(std::memory_order_relaxed));
+	}
+
+
+	void VKPipelineCache::ReportStartup()
+	{
+		double created = GetCreationTime() * 1000.0;
+		uint32_t count = GetPipelineCount();
+
+		if (IsWarm() && m_coldCreationTime > 0.0) {
+			double cold = m_coldCreationTime * 1000.0;
+			LOG_RENDER_INFO("VKPipelineCache: {} pipeline(s) created in {:.2f} ms with warm cache (cold start {:.2f} ms, saved {:.2f} ms).",
+				count, created, cold, cold - created);
+		}
+		else {
+			LOG_RENDER_INFO("VKPipelineCache: {} pipeline(s) created in {:.2f} ms ({}).",
+				count, created, m_persistent ? "cold cache" : "cache not persistent");
+		}
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,101 @@
+//==============================================================================
+// Vulkan Pipeline Cache
+//
+// Renderer-owned vk::PipelineCache that persists between runs. The cache data
+// is loaded from and saved to the user-writable VFS cache location, so after
+// the first start the driver can skip most of the SPIR-V compilation when
+// pipelines are created. Every VKPipelineBuilder build goes through it and
+// reports its creation time, which allows comparing a warm start against the
+// cold start that created the cache file.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - One cache file per GPU (vendor/device ID in the file name).
+// - File header with driver version, pipelineCacheUUID, data size and hash;
+//   stale or corrupt files are discarded instead of handed to the driver.
+// - Pipeline creation time statistics, startup report (time saved vs. cold).
+// - Can be disabled via renderer_vulkan/PipelineCache/Enabled.
+//
+// Notes:
+// - File location: @cache:/vulkan/pipelines_<vendor>_<device>.bin
+// - Thread-safe as far as Vulkan is concerned (vk::PipelineCache is internally
+//   synchronized), the statistics use atomics.
+//
+// Changelog:
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <atomic>
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	class VKPipelineCache
+	{
+	public:
+		VKPipelineCache(const VKDeviceManager& deviceManager, bool persistent = true);
+		~VKPipelineCache();
+
+		// Prevent copying and moving
+		VKPipelineCache(const VKPipelineCache&) = delete;
+		VKPipelineCache& operator=(const VKPipelineCache&) = delete;
+		VKPipelineCache(VKPipelineCache&&) = delete;
+		VKPipelineCache& operator=(VKPipelineCache&&) = delete;
+
+		// Writes the current cache data (only if persistent)
+		bool Save();
+
+		// Called by VKPipeline for every pipeline created through the cache
+		void RecordPipelineCreation(uint64_t ticks);
+
+		// Logs the pipeline creation time so far and compares it with the cold start
+		void ReportStartup();
+
+		// --- Accessors ---
+		vk::PipelineCache Get() const { return m_pipelineCache; }
+		bool IsWarm() const { return m_loadedBytes > 0; }
+		uint32_t GetPipelineCount() const { return m_pipelineCount.load(std::memory_order_relaxed); }
+		double GetCreationTime() const; // seconds
+
+	private:
+		std::vector<uint8_t> Load();
+
+	private:
+		// Stored in front of the driver data (the driver data has its own header,
+		// but the driver is not required to validate it thoroughly)
+		struct FileHeader {
+			uint32_t Magic;
+			uint32_t Version;
+			uint32_t VendorID;
+			uint32_t DeviceID;
+			uint32_t DriverVersion;
+			uint8_t  CacheUUID[VK_UUID_SIZE];
+			uint64_t DataSize;
+			uint64_t DataHash;
+			double   ColdCreationTime; // seconds spent creating pipelines when the cache was empty
+		};
+		static constexpr uint32_t FILE_MAGIC = 0x43504548; // "HEPC"
+		static constexpr uint32_t FILE_VERSION = 1;
+
+		vk::PipelineCache m_pipelineCache = nullptr;
+		vk::PhysicalDeviceProperties m_deviceProperties;
+		std::string m_path;
+		bool m_persistent = true;
+
+		size_t m_loadedBytes = 0;
+		double m_coldCreationTime = 0.0; // from the file (warm) or measured (cold)
+		std::atomic<uint32_t> m_pipelineCount = 0;
+		std::atomic<uint64_t> m_creationTicks = 0;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
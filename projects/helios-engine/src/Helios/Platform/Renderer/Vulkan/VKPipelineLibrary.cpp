@@ -0,0 +1,196 @@
+//==============================================================================
+// Vulkan Pipeline Library (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Further information in the corresponding header file VKPipelineLibrary.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKPipelineLibrary.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	VKPipelineLibrary::~VKPipelineLibrary()
+	{
+		Clear();
+	}
+
+
+	std::pair<Ref<VKPipelineLibrary::Entry>, bool> VKPipelineLibrary::FindOrInsert(PipelineKey key)
+	{
+		Ref<Entry> entry;
+		{
+			std::shared_lock lock(m_mutex);
+			auto it = m_entries.find(key);
+			if (it != m_entries.end())
+				entry = it->second;
+		}
+
+		if (!entry) {
+			std::unique_lock lock(m_mutex);
+			auto [it, inserted] = m_entries.try_emplace(key, nullptr);
+			if (inserted) {
+				it->second = CreateRef<Entry>();
+				return { it->second, true };
+			}
+			entry = it->second;
+		}
+
+		// A failed entry goes back to pending, only the caller that claims it compiles again
+		bool failed = true;
+		bool retry = entry->Failed.compare_exchange_strong(failed, false, std::memory_order_acq_rel);
+		return { entry, retry };
+	}
+
+
+	void VKPipelineLibrary::Compile(Entry& entry, VKPipelineBuilder& builder, PipelineKey key)
+	{
+		HE_PROFILE_FUNCTION();
+
+		try {
+			entry.Pipeline = builder.Build();
+			entry.Ready.store(true, std::memory_order_release);
+			LOG_RENDER_DEBUG("VKPipelineLibrary: Pipeline {:016x} compiled.", key);
+		}
+		catch (const std::exception& e) {
+			entry.Failed.store(true, std::memory_order_release);
+			LOG_RENDER_ERROR("VKPipelineLibrary: Pipeline {:016x} failed to compile: {}", key, e.what());
+		}
+	}
+
+
+	Ref<VKPipeline> VKPipelineLibrary::GetOrCreate(VKPipelineBuilder& builder)
+	{
+		HE_PROFILE_FUNCTION();
+
+		PipelineKey key = builder.ComputeHash();
+		auto [entry, compile] = FindOrInsert(key);
+
+		if (compile) {
+			m_misses.fetch_add(1, std::memory_order_relaxed);
+			Compile(*entry, builder, key);
+		}
+		else {
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+			// Same state requested asynchronously before, help until it is done
+			while (!entry->Ready.load(std::memory_order_acquire) && !entry->Failed.load(std::memory_order_acquire)) {
+				if (JobSystem* jobs = JobSystem::Get())
+					jobs->Wait(m_pending);
+				else
+					std::this_thread::yield();
+			}
+		}
+
+		if (!entry->Ready.load(std::memory_order_acquire)) {
+			LOG_RENDER_EXCEPT("VKPipelineLibrary: Pipeline {:016x} is not available.", key);
+		}
+		return entry->Pipeline;
+	}
+
+
+	PipelineKey VKPipelineLibrary::Request(Scope<VKPipelineBuilder> builder)
+	{
+		HE_PROFILE_FUNCTION();
+
+		PipelineKey key = builder->ComputeHash();
+		auto [entry, compile] = FindOrInsert(key);
+		if (!compile) {
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+			return key;
+		}
+		m_misses.fetch_add(1, std::memory_order_relaxed);
+
+		JobSystem* jobs = JobSystem::Get();
+		if (!jobs) {
+			Compile(*entry, *builder, key);
+			return key;
+		}
+
+		// std::function needs a copyable callable
+		Ref<VKPipelineBuilder> shared = std::move(builder);
+		jobs->Run([this, entry, shared, key] { Compile(*entry, *shared, key); }, &m_pending);
+		return key;
+	}
+
+
+	const VKPipeline* VKPipelineLibrary::Resolve(PipelineKey key, const VKPipeline* fallback) const
+	{
+		std::shared_lock lock(m_mutex);
+		auto it = m_entries.find(key);
+		if (it == m_entries.end() || !it->second->Ready.load(std::memory_order_acquire))
+			return fallback;
+		return it->second->Pipeline.get();
+	}
+
+
+	bool VKPipelineLibrary::IsReady(PipelineKey key) const
+	{
+		std::shared_lock lock(m_mutex);
+		auto it = m_entries.find(key);
+		return it != m_entries.end() && it->second->Ready.load(std::memory_order_acquire);
+	}
+
+
+	PipelineStatus VKPipelineLibrary::GetStatus(PipelineKey key) const
+	{
+		std::shared_lock lock(m_mutex);
+		auto it = m_entries.find(key);
+		if (it == m_entries.end())
+			return PipelineStatus::Unknown;
+		if (it->second->Ready.load(std::memory_order_acquire))
+			return PipelineStatus::Ready;
+		if (it->second->Failed.load(std::memory_order_acquire))
+			return PipelineStatus::Failed;
+		return PipelineStatus::Pending;
+	}
+
+
+	Ref<VKPipeline> VKPipelineLibrary::Get(PipelineKey key) const
+	{
+		std::shared_lock lock(m_mutex);
+		auto it = m_entries.find(key);
+		if (it == m_entries.end() || !it->second->Ready.load(std::memory_order_acquire))
+			return nullptr;
+		return it->second->Pipeline;
+	}
+
+
+	void VKPipelineLibrary::Release(PipelineKey key)
+	{
+		std::unique_lock lock(m_mutex);
+		if (m_entries.erase(key))
+			LOG_RENDER_DEBUG("VKPipelineLibrary: Pipeline {:016x} released.", key);
+	}
+
+
+	void VKPipelineLibrary::WaitIdle()
+	{
+		if (m_pending.IsDone())
+			return;
+		if (JobSystem* jobs = JobSystem::Get())
+			jobs->Wait(m_pending);
+	}
+
+
+	void VKPipelineLibrary::Clear()
+	{
+		WaitIdle();
+
+		std::unique_lock lock(m_mutex);
+		if (!m_entries.empty()) {
+			LOG_RENDER_DEBUG("VKPipelineLibrary: {} pipeline(s) destroyed ({} hits, {} misses).", m_entries.size(), GetHits(), GetMisses());
+			m_entries.clear();
+		}
+	}
+
+
+	uint32_t VKPipelineLibrary::GetPipelineCount() const
+	{
+		std::shared_lock lock(m_mutex);
+		return static_cast<uint32_t>(m_entries.size());
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -0,0 +1,117 @@
+//==============================================================================
+// Vulkan Pipeline Library
+//
+// Deduplicates graphics pipelines by their complete state: builders with the
+// same shader code, fixed-function state, layout and a compatible render pass
+// share one VKPipeline instead of compiling it again. Missing pipelines can be
+// compiled on JobSystem workers; until such a pipeline is ready, callers draw
+// with a fallback pipeline of their choice, so pipeline creation never stalls
+// a frame.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Pipelines keyed by VKPipelineBuilder::ComputeHash.
+// - GetOrCreate: synchronous (startup, fallback pipelines).
+// - Request/Resolve: asynchronous compile, never blocks the caller.
+// - Hit/miss/compile statistics.
+//
+// Usage:
+//   PipelineKey key = library.Request(std::move(builder));      // load time
+//   const VKPipeline* pipeline = library.Resolve(key, fallback); // every frame
+//
+// Notes:
+// - Compiles run synchronously if no JobSystem exists.
+// - The library keeps a reference to each pipeline until Release(key), Clear()
+//   or destruction. Clear() and destruction wait for pending compiles and
+//   require the GPU to be idle. Release() only drops the library's reference,
+//   so callers holding a Ref keep the pipeline alive until the GPU is done
+//   with it (e.g. the pipeline replaced by a hot reload).
+// - A failed compile is retried by the next Request/GetOrCreate of its key.
+//
+// Changelog:
+// - 2026.10: Failed entries are retried on the next request, Release(key) for unused pipelines
+// - 2026.10: Added GetStatus and Get (hot reload swaps pipelines once ready)
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Platform/Renderer/Vulkan/VKPipeline.h"
+#include "Helios/Engine/Core/JobSystem.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	using PipelineKey = uint64_t;
+
+
+	enum class PipelineStatus { Unknown, Pending, Ready, Failed };
+
+
+	class VKPipelineLibrary
+	{
+	public:
+		VKPipelineLibrary() = default;
+		~VKPipelineLibrary();
+
+		// Prevent copying and moving
+		VKPipelineLibrary(const VKPipelineLibrary&) = delete;
+		VKPipelineLibrary& operator=(const VKPipelineLibrary&) = delete;
+		VKPipelineLibrary(VKPipelineLibrary&&) = delete;
+		VKPipelineLibrary& operator=(VKPipelineLibrary&&) = delete;
+
+		// Shared pipeline for the builder's state, compiled now on a miss
+		// (waits if the same state is already compiling on a worker)
+		Ref<VKPipeline> GetOrCreate(VKPipelineBuilder& builder);
+
+		// Starts compiling the builder's state on a worker unless known already
+		// (a failed compile is started again). The builder is kept alive until
+		// the compile finished.
+		PipelineKey Request(Scope<VKPipelineBuilder> builder);
+
+		// The pipeline for key once compiled, fallback while pending (or failed)
+		const VKPipeline* Resolve(PipelineKey key, const VKPipeline* fallback) const;
+		bool IsReady(PipelineKey key) const;
+		PipelineStatus GetStatus(PipelineKey key) const;
+
+		// Shared pipeline for key, nullptr unless compiled
+		Ref<VKPipeline> Get(PipelineKey key) const;
+
+		// Drops the library's reference to key (pending compiles finish unobserved)
+		void Release(PipelineKey key);
+
+		// Waits for all pending compiles
+		void WaitIdle();
+		// Destroys all pipelines (GPU must not use them anymore)
+		void Clear();
+
+		// --- Statistics ---
+		uint32_t GetPipelineCount() const;
+		uint32_t GetPendingCount() const { return m_pending.GetValue(); }
+		uint64_t GetHits() const { return m_hits.load(std::memory_order_relaxed); }
+		uint64_t GetMisses() const { return m_misses.load(std::memory_order_relaxed); }
+
+	private:
+		struct Entry {
+			Ref<VKPipeline> Pipeline;         // set once, before Ready
+			std::atomic<bool> Ready = false;
+			std::atomic<bool> Failed = false;
+		};
+
+		// Returns the entry for key and whether this call has to compile it
+		// (newly created, or failed before and claimed for a retry)
+		std::pair<Ref<Entry>, bool> FindOrInsert(PipelineKey key);
+		void Compile(Entry& entry, VKPipelineBuilder& builder, PipelineKey key);
+
+	private:
+		mutable std::shared_mutex m_mutex;
+		std::unordered_map<PipelineKey, Ref<Entry>> m_entries; // shared with compile jobs and waiters
+
+		JobCounter m_pending;
+		std::atomic<uint64_t> m_hits = 0;
+		std::atomic<uint64_t> m_misses = 0;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
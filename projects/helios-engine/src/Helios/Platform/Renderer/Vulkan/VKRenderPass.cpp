@@ -9,6 +9,8 @@
 #include "pch.h"
 #include "VKRenderPass.h"
 
+#include "Helios/Engine/Util/Hash.h"
+
 namespace Helios::Engine::Renderer::Vulkan {
 
 
@@ -46,6 +48,20 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		m_renderPass = m_deviceManager.GetLogicalDevice().createRenderPass(renderPassInfo);
 		LOG_RENDER_DEBUG("VKRenderPass: RenderPass created.");
+
+		// Load/store ops and layouts do not affect compatibility
+		uint64_t hash = Util::HashCombine(0, m_attachments.size());
+		for (const auto& attachment : m_attachments) {
+			hash = Util::HashCombine(hash, static_cast<uint64_t>(attachment.format));
+			hash = Util::HashCombine(hash, static_cast<uint64_t>(attachment.samples));
+		}
+		for (size_t i = 0; i < m_subpasses.size(); ++i) {
+			hash = Util::HashCombine(hash, m_subpassAttachmentRefs[i].size());
+			for (const auto& ref : m_subpassAttachmentRefs[i])
+				hash = Util::HashCombine(hash, ref.attachment);
+			hash = Util::HashCombine(hash, m_subpasses[i].pDepthStencilAttachment ? m_subpasses[i].pDepthStencilAttachment->attachment + 1ull : 0ull);
+		}
+		m_compatibilityHash = hash;
 	}
 
 
@@ -17,6 +17,7 @@
 //
 //
 // Changelog:
+// - 2026.10: Added render pass compatibility hash (pipeline deduplication)
 // - 2026.01: Refactored to use a builder pattern
 // - 2026.01: Initial version
 //==============================================================================
@@ -44,11 +45,16 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		vk::RenderPass Get() const { return m_renderPass; }
 
+		// Equal for render passes a pipeline can be used with interchangeably
+		// (attachment formats and sample counts, subpass attachment references)
+		uint64_t GetCompatibilityHash() const { return m_compatibilityHash; }
+
 	private:
 		friend class VKRenderPassBuilder;
 
 		const VKDeviceManager& m_deviceManager;
 		vk::RenderPass m_renderPass = nullptr;
+		uint64_t m_compatibilityHash = 0;
 
 		std::vector<vk::AttachmentDescription> m_attachments;
 		std::vector<vk::SubpassDescription> m_subpasses;
@@ -10,6 +10,7 @@
 #include "Helios/Platform/Renderer/Vulkan/VKRenderer.h"
 
 #include "Helios/Engine/Core/Config.h"
+#include "Helios/Engine/Core/FrameStats.h"
 #include "Helios/Engine/VFS/VFS.h"
 
 #ifdef BUILD_DEBUG
@@ -23,14 +24,38 @@
 //#define GLM_ENABLE_EXPERIMENTAL
 //#include <glm/gtx/string_cast.hpp>
 
+#include <bit>
+
 namespace Helios::Engine::Renderer::Vulkan {
 
 
-	void VKRenderer::Init(const AppSpec& appSpec, Window& window)
+	namespace {
+
+		// Initial per-frame capacities, the buffers grow in powers of two
+		constexpr uint32_t MinDrawInstances = 1024;
+		constexpr uint32_t MinDrawCommands = 256;
+
+		// Instance data is gathered on the job system above this count
+		constexpr uint32_t ParallelGatherThreshold = 32768;
+		constexpr uint32_t ParallelGatherBatch = 8192;
+
+		// Upper limit of parallel recording slots (command pools per frame)
+		constexpr uint32_t MaxRecordSlots = 32;
+
+		constexpr const char* DrawModeNames[] = { "direct draws", "multi draw indirect" };
+
+	} // anonymous namespace
+
+
+	void VKRenderer::Init(const AppSpec& appSpec, Window* window)
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Renderer");
+
 		LOG_RENDER_INFO("Initializing Vulkan Renderer...");
 
-		m_Window = &window;
+		m_Window = window;
+		m_headless = (window == nullptr);
 
 		// Load the configuration for the Vulkan renderer
 		ConfigManager::GetInstance().LoadDomain("renderer_vulkan");
@@ -44,29 +69,76 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		DEBUG_FILTER_ID(0); // Massive clutter
 		DEBUG_FILTER_ID(601872502); // Khronos Validation Layer Active...
-		m_vkInstance = VKInstanceBuilder()
-			.SetAppSpec(appSpec)
-			.WithGlfwExtensions()
-			.Build();
+		VKInstanceBuilder instanceBuilder;
+		instanceBuilder.SetAppSpec(appSpec);
+		if (!m_headless)
+			instanceBuilder.WithGlfwExtensions();
+		m_vkInstance = instanceBuilder.Build();
 		DEBUG_FILTER_RESET();
 
-		m_vkSurface = CreateScope<VKSurface>(*m_vkInstance, *m_Window);
+		if (!m_headless)
+			m_vkSurface = CreateScope<VKSurface>(*m_vkInstance, *m_Window);
 
 		DEBUG_FILTER_ID(0); // Massive clutter
-		m_vkDeviceManager = CreateScope<VKDeviceManager>(*m_vkInstance, *m_vkSurface);
+		m_vkDeviceManager = CreateScope<VKDeviceManager>(*m_vkInstance, m_vkSurface.get());
 		DEBUG_FILTER_RESET();
 
-		m_vkSwapchain = CreateScope<VKSwapchain>(*m_vkDeviceManager, *m_vkSurface, *m_Window);
-		m_framesCount = m_vkSwapchain->GetImageCount();
+		if (m_headless) {
+			vk::Extent2D extent = { appSpec.Headless.Width, appSpec.Headless.Height };
+			m_vkOffscreenTarget = CreateScope<VKOffscreenTarget>(*m_vkDeviceManager, extent, appSpec.Headless.ImageCount);
+			m_framesCount = m_vkOffscreenTarget->GetImageCount();
+			LOG_RENDER_INFO("VKRenderer: Headless, rendering into {} offscreen image(s) of {}x{}.", m_framesCount, extent.width, extent.height);
+		}
+		else {
+			m_vkSwapchain = CreateScope<VKSwapchain>(*m_vkDeviceManager, *m_vkSurface, *m_Window);
+			m_framesCount = m_vkSwapchain->GetImageCount();
+		}
 
 		CreateSimpleRenderPass();
-		m_vkSwapchain->CreateFramebuffers(m_vkRenderPass->Get());
+		if (m_headless)
+			m_vkOffscreenTarget->CreateFramebuffers(m_vkRenderPass->Get());
+		else
+			m_vkSwapchain->CreateFramebuffers(m_vkRenderPass->Get());
+
+		// Pipelines are compiled through the persistent cache (@cache:/vulkan)
+		bool persistentCache = ConfigManager::GetInstance().Get<bool>("renderer_vulkan", "PipelineCache", "Enabled", true);
+		m_vkPipelineCache = CreateScope<VKPipelineCache>(*m_vkDeviceManager, persistentCache);
+		m_vkPipelineLibrary = CreateScope<VKPipelineLibrary>();
+
+		// Shader modules are shared between builds. With a source path configured the
+		// GLSL sources are used directly (compiled once, cooked SPIR-V kept in @cache:)
+		m_vkShaderCache = CreateScope<VKShaderCache>(*m_vkDeviceManager);
+		std::string shaderSourcePath = ConfigManager::GetInstance().Get<std::string>("renderer_vulkan", "ShaderCache", "SourcePath", "");
+		if (!shaderSourcePath.empty()) {
+			VirtFS.Mount("shader_src", shaderSourcePath, 0, "HeliosEngine");
+			VirtFS.CreateAlias("@shader_src:", "shader_src");
+			LOG_RENDER_INFO("VKRenderer: Shaders are compiled from GLSL sources in '{}'.", shaderSourcePath);
+
+			if (ConfigManager::GetInstance().Get<bool>("renderer_vulkan", "ShaderCache", "HotReload", true)) {
+				float interval = ConfigManager::GetInstance().Get<float>("renderer_vulkan", "ShaderCache", "HotReloadInterval", 0.5f);
+				m_shaderWatcher = CreateScope<VFS::FileWatcher>(interval);
+			}
+		}
+
+		// Global descriptor set, part of every pipeline layout (set 0)
+		if (m_vkDeviceManager->GetFeatures().descriptorIndexing)
+			m_vkBindlessHeap = CreateScope<VKBindlessHeap>(*m_vkDeviceManager, static_cast<uint32_t>(m_framesCount));
+		else
+			LOG_RENDER_WARN("VKRenderer: Descriptor indexing not supported, no bindless descriptor heap.");
 
 		CreateSimpleGraphicsPipeline();
+		m_vkPipelineCache->ReportStartup();
+		m_vkPipelineCache->Save();
 
 		CreateCommandPool();
-		CreateCommandBuffers();
+		m_vkFrameContext = CreateScope<VKFrameContext>(*m_vkDeviceManager, static_cast<uint32_t>(m_framesCount));
+		CreateParallelRecorder();
 		CreateSyncObjects();
+		CreateTimestampQueries();
+
+		m_vkUploadManager = CreateScope<VKUploadManager>(*m_vkDeviceManager, static_cast<uint32_t>(m_framesCount));
+		CreateMeshPool();
+		CreateSimpleGeometry();
 	}
 
 
@@ -74,6 +146,11 @@ namespace Helios::Engine::Renderer::Vulkan {
 	{
 		LOG_RENDER_INFO("Shutting down Vulkan Renderer...");
 
+		// Reload jobs use the pipeline library and shader cache
+		m_shaderWatcher.reset();
+		if (JobSystem* jobs = JobSystem::Get())
+			jobs->Wait(m_reloadJobs);
+
 		m_vkDeviceManager->GetLogicalDevice().waitIdle();
 
 		// Destruction must happen in the reverse order of creation to respect dependencies.
@@ -85,10 +162,32 @@ namespace Helios::Engine::Renderer::Vulkan {
 			m_vkDeviceManager->GetLogicalDevice().destroyFence(m_inFlightFences[i]);
 		}
 		m_vkDeviceManager->GetLogicalDevice().destroyCommandPool(m_commandPool);
-
+		m_vkFrameContext.reset();
+		m_vkParallelRecorder.reset();
+		if (m_timestampPool)
+			m_vkDeviceManager->GetLogicalDevice().destroyQueryPool(m_timestampPool);
+
+		for (DrawFrameData& frame : m_drawFrames) {
+			for (vk::ShaderModule module : frame.RetiredShaderModules)
+				m_vkDeviceManager->GetLogicalDevice().destroyShaderModule(module);
+		}
+		m_drawFrames.clear();
+		m_meshIndexBuffer.reset();
+		m_meshVertexBuffer.reset();
+		m_vkUploadManager.reset();
 		m_vkPipeline.reset();
+		m_vkPipelineLibrary.reset();
+		m_vkBindlessHeap.reset();
+		m_vkShaderCache.reset();
+		if (m_vkPipelineCache) {
+			m_vkPipelineCache->Save();
+			m_vkPipelineCache.reset();
+		}
 		m_vkRenderPass.reset();
+		m_vkOffscreenTarget.reset();
 		m_vkSwapchain.reset();
+		if (m_vkDeviceManager)
+			m_vkDeviceManager->GetMemoryAllocator().LogStats();
 		m_vkDeviceManager.reset();
 		m_vkSurface.reset();
 
@@ -108,9 +207,18 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	bool VKRenderer::BeginFrame(Camera& camera)
+	bool VKRenderer::BeginFrame(const FramePacket& packet)
 	{
-		m_sceneData.ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Renderer");
+
+		// Skip frames until the main thread has recreated the swapchain (RecreateSwapchain)
+		if (m_swapchainOutOfDate.load(std::memory_order_acquire)) {
+			m_stateBeginFrameSuccess = false;
+			return m_stateBeginFrameSuccess;
+		}
+
+		m_sceneData.ViewProjectionMatrix = packet.ViewProjection;
 		//static auto startTime = std::chrono::high_resolution_clock::now();
 		//auto currentTime = std::chrono::high_resolution_clock::now();
 		//m_sceneData.time = std::chrono::duration<float, std::chrono::seconds::period>(currentTime - startTime).count();
@@ -118,7 +226,14 @@ namespace Helios::Engine::Renderer::Vulkan {
 		vk::Device logicalDevice = m_vkDeviceManager->GetLogicalDevice();
 
 		// Wait for the frame to be finished
-		vk::Result waitResult = logicalDevice.waitForFences(1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+		vk::Result waitResult;
+		{
+			HE_PROFILE_SCOPE("WaitForFence");
+			uint64_t waitBegin = Clock::Now();
+			waitResult = logicalDevice.waitForFences(1, &m_inFlightFences[m_currentFrame], VK_TRUE, UINT64_MAX);
+			m_frameBeginTicks = Clock::Now();
+			FrameStats::Record(FrameStat::FenceWait, m_frameBeginTicks - waitBegin);
+		}
 		if (waitResult != vk::Result::eSuccess) {
 			// This is a critical error. The cause could be a device loss, a driver crash, or a timeout
 			// (which is unlikely with UINT64_MAX but indicates a GPU hang).
@@ -126,15 +241,32 @@ namespace Helios::Engine::Renderer::Vulkan {
 			LOG_RENDER_EXCEPT("Failed to wait for fence! Result: {}", vk::to_string(waitResult));
 		}
 
-		// Acquire an image from the swap chain
-		try {
-			vk::ResultValue result = logicalDevice.acquireNextImageKHR(m_vkSwapchain->GetSwapchain(), UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], nullptr);
-			m_currentImageIndex = result.value;
+		// The frame that used this slot before has finished, its timestamps are available
+		ReadTimestamps(m_currentFrame);
+		m_vkDeviceManager->GetMemoryAllocator().UpdateBudget();
+		RecycleFrame(m_currentFrame);
+
+		// Safe point for hot reloaded pipelines (the old one is retired with this frame slot,
+		// frames still in flight keep using it)
+		if (m_shaderWatcher) {
+			m_shaderWatcher->Poll();
+			ApplyReloadedPipeline();
 		}
-		catch (const vk::OutOfDateKHRError&) {
-			m_vkSwapchain->Recreate(*m_Window, m_vkRenderPass->Get());
-			m_stateBeginFrameSuccess = false;
-			return m_stateBeginFrameSuccess;
+
+		// Acquire an image from the swap chain (offscreen images map 1:1 to frames in flight)
+		if (m_headless) {
+			m_currentImageIndex = m_currentFrame;
+		}
+		else {
+			try {
+				vk::ResultValue result = logicalDevice.acquireNextImageKHR(m_vkSwapchain->GetSwapchain(), UINT64_MAX, m_imageAvailableSemaphores[m_currentFrame], nullptr);
+				m_currentImageIndex = result.value;
+			}
+			catch (const vk::OutOfDateKHRError&) {
+				m_swapchainOutOfDate.store(true, std::memory_order_release);
+				m_stateBeginFrameSuccess = false;
+				return m_stateBeginFrameSuccess;
+			}
 		}
 
 		// Reset the fence only when we are about to submit new work
@@ -143,39 +275,26 @@ namespace Helios::Engine::Renderer::Vulkan {
 			LOG_RENDER_EXCEPT("Failed to reset fence! Result: {}", vk::to_string(resetResult));
 		}
 
-		// Record the command buffer
-		vk::CommandBuffer commandBuffer = m_commandBuffers[m_currentFrame];
-		commandBuffer.reset();
-
-		commandBuffer.begin(vk::CommandBufferBeginInfo{});
-
-		vk::ClearValue clearColor(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
-		vk::RenderPassBeginInfo renderPassInfo = vk::RenderPassBeginInfo()
-			.setRenderPass(m_vkRenderPass->Get())
-			.setFramebuffer(m_vkSwapchain->GetFramebuffers()[m_currentImageIndex]->Get())
-			.setRenderArea({ {0, 0}, m_vkSwapchain->GetExtent() })
-			.setClearValueCount(1)
-			.setPClearValues(&clearColor);
+		// Record the command buffer (reset with the frame's pool in RecycleFrame)
+		vk::CommandBuffer commandBuffer = m_vkFrameContext->GetCommandBuffer();
+		commandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
 
-		commandBuffer.beginRenderPass(renderPassInfo, vk::SubpassContents::eInline);
-
-		commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, m_vkPipeline->GetPipeline());
-
-		vk::Viewport viewport = vk::Viewport()
-			.setX(0.0f)
-			.setY(0.0f)
-			.setWidth(static_cast<float>(m_vkSwapchain->GetExtent().width))
-			.setHeight(static_cast<float>(m_vkSwapchain->GetExtent().height))
-			.setMinDepth(0.0f)
-			.setMaxDepth(1.0f);
-		commandBuffer.setViewport(0, { viewport });
+		if (m_timestampPool) {
+			commandBuffer.resetQueryPool(m_timestampPool, m_currentFrame * 2, 2);
+			commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eTopOfPipe, m_timestampPool, m_currentFrame * 2);
+		}
 
-		vk::Rect2D scissor = vk::Rect2D()
-			.setOffset({ 0, 0 })
-			.setExtent(m_vkSwapchain->GetExtent());
-		commandBuffer.setScissor(0, { scissor });
+		// Uploads queued until now go out as one transfer batch, acquire barriers land before the render pass.
+		// Meshes are uploaded before they are added, so every mesh counted here is part of this batch
+		{
+			std::lock_guard lock(m_meshMutex);
+			m_readyMeshCount = static_cast<uint32_t>(m_meshes.size());
+		}
+		m_uploadSemaphore = m_vkUploadManager->Submit(m_currentFrame, commandBuffer);
+		m_drawList = &packet.Draws;
 
-		commandBuffer.pushConstants(m_vkPipeline->GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(SceneData), &m_sceneData);
+		// The render pass begins in DrawFrame, which knows whether it records inline or in parallel
+		m_renderPassBegun = false;
 
 		m_stateBeginFrameSuccess = true;
 		return m_stateBeginFrameSuccess;
@@ -184,21 +303,52 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 	void VKRenderer::EndFrame()
 	{
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Renderer");
+
 		if (!m_stateBeginFrameSuccess) {
 			return;
 		}
 
-		vk::CommandBuffer commandBuffer = m_commandBuffers[m_currentFrame];
+		// Nothing was drawn, the pass still clears the target
+		if (!m_renderPassBegun)
+			BeginRenderPass(vk::SubpassContents::eInline);
+
+		// Secondaries recorded in parallel by DrawFrame, in chunk order
+		vk::CommandBuffer commandBuffer = m_vkFrameContext->GetCommandBuffer();
+		if (m_vkParallelRecorder && !m_vkParallelRecorder->GetRecorded().empty())
+			commandBuffer.executeCommands(m_vkParallelRecorder->GetRecorded());
 		commandBuffer.endRenderPass();
+		if (m_timestampPool) {
+			commandBuffer.writeTimestamp(vk::PipelineStageFlagBits::eBottomOfPipe, m_timestampPool, m_currentFrame * 2 + 1);
+			m_timestampsWritten[m_currentFrame] = true;
+		}
 		commandBuffer.end();
 
+		// Headless: nothing to present, the fence alone tracks the frame
+		vk::PipelineStageFlags uploadWaitStages = m_vkUploadManager->GetWaitStages();
+		if (m_headless) {
+			vk::SubmitInfo submitInfo = vk::SubmitInfo()
+				.setWaitSemaphoreCount(m_uploadSemaphore ? 1 : 0)
+				.setPWaitSemaphores(&m_uploadSemaphore)
+				.setPWaitDstStageMask(&uploadWaitStages)
+				.setCommandBufferCount(1)
+				.setPCommandBuffers(&commandBuffer);
+			m_vkDeviceManager->GetGraphicsQueue().submit({ submitInfo }, m_inFlightFences[m_currentFrame]);
+			FrameStats::Record(FrameStat::RenderSubmit, Clock::Now() - m_frameBeginTicks);
+
+			m_lastImageIndex = m_currentImageIndex;
+			m_currentFrame = (m_currentFrame + 1) % m_framesCount;
+			return;
+		}
+
 		// Submit the command buffer
-		vk::Semaphore waitSemaphores[] = { m_imageAvailableSemaphores[m_currentFrame] };
-		vk::PipelineStageFlags waitStages[] = { vk::PipelineStageFlagBits::eColorAttachmentOutput };
+		vk::Semaphore waitSemaphores[] = { m_imageAvailableSemaphores[m_currentFrame], m_uploadSemaphore };
+		vk::PipelineStageFlags waitStages[] = { vk::PipelineStageFlagBits::eColorAttachmentOutput, uploadWaitStages };
 		vk::Semaphore signalSemaphores[] = { m_renderFinishedSemaphores[m_currentFrame] };
 
 		vk::SubmitInfo submitInfo = vk::SubmitInfo()
-			.setWaitSemaphoreCount(1)
+			.setWaitSemaphoreCount(m_uploadSemaphore ? 2 : 1)
 			.setPWaitSemaphores(waitSemaphores)
 			.setPWaitDstStageMask(waitStages)
 			.setCommandBufferCount(1)
@@ -217,16 +367,22 @@ namespace Helios::Engine::Renderer::Vulkan {
 			.setPSwapchains(swapChains)
 			.setPImageIndices(&m_currentImageIndex);
 
+		uint64_t presentBegin = Clock::Now();
+		FrameStats::Record(FrameStat::RenderSubmit, presentBegin - m_frameBeginTicks);
+
 		vk::Result presentResult = vk::Result::eSuccess;
 		try {
+			HE_PROFILE_SCOPE("Present");
 			presentResult = m_vkDeviceManager->GetPresentQueue().presentKHR(presentInfo);
 		}
 		catch (const vk::OutOfDateKHRError&) {
 			presentResult = vk::Result::eErrorOutOfDateKHR;
 		}
+		FrameStats::Record(FrameStat::Present, Clock::Now() - presentBegin);
 
+		// Recreated by the main thread, the window size must not be queried from the render thread
 		if (presentResult == vk::Result::eErrorOutOfDateKHR || presentResult == vk::Result::eSuboptimalKHR) {
-			m_vkSwapchain->Recreate(*m_Window, m_vkRenderPass->Get());
+			m_swapchainOutOfDate.store(true, std::memory_order_release);
 		}
 
 		m_currentFrame = (m_currentFrame + 1) % m_framesCount;
@@ -235,22 +391,296 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 	void VKRenderer::DrawFrame()
 	{
-		if (!m_stateBeginFrameSuccess) {
+		HE_PROFILE_FUNCTION();
+		HE_MEMORY_TAG("Renderer");
+
+		m_drawStats = {};
+		if (!m_stateBeginFrameSuccess || !m_drawList || m_drawList->IsEmpty()) {
 			return;
 		}
 
-		vk::CommandBuffer commandBuffer = m_commandBuffers[m_currentFrame];
+		vk::CommandBuffer commandBuffer = m_vkFrameContext->GetCommandBuffer();
+		VKMemoryAllocator& allocator = m_vkDeviceManager->GetMemoryAllocator();
+
+		// Sort by pipeline/material/mesh, every run of equal keys is one instanced draw
+		m_drawSorter.Sort(*m_drawList);
+		const std::vector<DrawBatch>& batches = m_drawSorter.GetBatches();
+		const std::vector<DrawInstance>& instances = m_drawList->GetInstances();
+		const uint32_t instanceCount = static_cast<uint32_t>(instances.size());
+
+		DrawFrameData& frame = m_drawFrames[m_currentFrame];
+		EnsureDrawCapacity(frame, instanceCount, static_cast<uint32_t>(batches.size()));
+
+		// Instance data in draw order, the batches address it through firstInstance
+		{
+			HE_PROFILE_SCOPE("GatherInstances");
+			InstanceData* instanceData = static_cast<InstanceData*>(frame.Instances->GetMapped());
+			auto gather = [&](uint32_t i) {
+				const DrawInstance& instance = instances[m_drawSorter.GetInstanceIndex(i)];
+				instanceData[i].Transform = instance.Transform;
+				instanceData[i].Color = instance.Color;
+			};
+			JobSystem* jobs = JobSystem::Get();
+			if (jobs && instanceCount >= ParallelGatherThreshold) {
+				jobs->ParallelFor(instanceCount, ParallelGatherBatch, gather);
+			}
+			else {
+				for (uint32_t i = 0; i < instanceCount; i++)
+					gather(i);
+			}
+			allocator.Flush(frame.Instances->GetAllocation(), 0, instanceCount * sizeof(InstanceData));
+		}
+
+		// One command per batch, grouped into ranges of the same pipeline (batches are sorted by pipeline first)
+		m_drawCommands.clear();
+		m_drawRanges.clear();
+		{
+			std::lock_guard lock(m_meshMutex);
+			for (const DrawBatch& batch : batches) {
+				// Unknown handle, or created after this frame's upload batch
+				if (batch.Mesh >= m_readyMeshCount)
+					continue;
+
+				if (m_drawRanges.empty() || m_drawRanges.back().Pipeline != batch.Pipeline)
+					m_drawRanges.push_back({ batch.Pipeline, static_cast<uint32_t>(m_drawCommands.size()), 0 });
+				m_drawRanges.back().CommandCount++;
+
+				const MeshRange& mesh = m_meshes[batch.Mesh];
+				m_drawCommands.emplace_back(mesh.IndexCount, batch.InstanceCount, mesh.FirstIndex, mesh.VertexOffset, batch.FirstInstance);
+			}
+		}
+		const uint32_t commandCount = static_cast<uint32_t>(m_drawCommands.size());
+
+		// The mapped memory may be write-combined, it is only written (direct draws read m_drawCommands)
+		if (m_drawMode != DrawMode::Direct) {
+			const vk::DeviceSize commandBytes = commandCount * sizeof(vk::DrawIndexedIndirectCommand);
+			std::memcpy(frame.Commands->GetMapped(), m_drawCommands.data(), static_cast<size_t>(commandBytes));
+			allocator.Flush(frame.Commands->GetAllocation(), 0, commandBytes);
+		}
+
+		// Large frames are split by command into chunks recorded into secondaries on the job system, the
+		// chunks need enough commands each to pay for the extra command buffers. Indirect ranges crossing
+		// a chunk border are split as well (RecordDraws), so every draw mode is chunked the same way.
+		const uint32_t chunkCount = m_vkParallelRecorder ? std::min(m_vkParallelRecorder->GetSlotCount(), commandCount / m_parallelMinDraws) : 0;
+		uint32_t drawCalls = 0;
+		if (chunkCount >= 2) {
+			HE_PROFILE_SCOPE("RecordParallel");
+			BeginRenderPass(vk::SubpassContents::eSecondaryCommandBuffers);
+
+			vk::CommandBufferInheritanceInfo inheritance = vk::CommandBufferInheritanceInfo()
+				.setRenderPass(m_vkRenderPass->Get())
+				.setSubpass(0)
+				.setFramebuffer(GetTargetFramebuffer(m_currentImageIndex));
+
+			const uint32_t chunkSize = (commandCount + chunkCount - 1) / chunkCount;
+			m_chunkDrawCalls.assign(chunkCount, 0);
+			m_vkParallelRecorder->Record(chunkCount, inheritance, [&](vk::CommandBuffer secondary, uint32_t chunk) {
+				const uint32_t begin = std::min(chunk * chunkSize, commandCount);
+				m_chunkDrawCalls[chunk] = RecordDraws(secondary, frame, begin, std::min(begin + chunkSize, commandCount));
+			});
+			for (uint32_t calls : m_chunkDrawCalls)
+				drawCalls += calls;
+			m_drawStats.CommandBuffers = chunkCount;
+		}
+		else {
+			BeginRenderPass(vk::SubpassContents::eInline);
+			drawCalls = RecordDraws(commandBuffer, frame, 0, commandCount);
+		}
+
+		m_drawStats.Instances = instanceCount;
+		m_drawStats.Batches = commandCount;
+		m_drawStats.DrawCalls = drawCalls;
+	}
+
+
+	uint32_t VKRenderer::RecordDraws(vk::CommandBuffer commandBuffer, const DrawFrameData& frame, uint32_t begin, uint32_t end) const
+	{
+		// Shared mesh pool and this frame's instances, bound once per command buffer
+		commandBuffer.bindVertexBuffers(0, { m_meshVertexBuffer->Get(), frame.Instances->Get() }, { vk::DeviceSize(0), vk::DeviceSize(0) });
+		commandBuffer.bindIndexBuffer(m_meshIndexBuffer->Get(), 0, vk::IndexType::eUint32);
+
+		const VKPipeline* boundPipeline = nullptr;
+		uint32_t drawCalls = 0;
+		for (size_t i = 0; i < m_drawRanges.size(); i++) {
+			// Part of the range inside [begin, end)
+			const DrawRange& range = m_drawRanges[i];
+			const uint32_t first = std::max(range.FirstCommand, begin);
+			const uint32_t last = std::min(range.FirstCommand + range.CommandCount, end);
+			if (first >= last)
+				continue;
+
+			const VKPipeline* pipeline = ResolvePipeline(range.Pipeline);
+			if (!pipeline)
+				continue;
+			if (pipeline != boundPipeline) {
+				BindDrawState(commandBuffer, *pipeline);
+				boundPipeline = pipeline;
+			}
+
+			const vk::DeviceSize commandOffset = first * sizeof(vk::DrawIndexedIndirectCommand);
+			const uint32_t count = last - first;
+			if (m_drawMode == DrawMode::Indirect) {
+				commandBuffer.drawIndexedIndirect(frame.Commands->Get(), commandOffset, count, sizeof(vk::DrawIndexedIndirectCommand));
+				drawCalls++;
+			}
+			else {
+				for (uint32_t c = first; c < last; c++) {
+					const vk::DrawIndexedIndirectCommand& command = m_drawCommands[c];
+					commandBuffer.drawIndexed(command.indexCount, command.instanceCount, command.firstIndex, command.vertexOffset, command.firstInstance);
+				}
+				drawCalls += count;
+			}
+		}
+		return drawCalls;
+	}
+
+
+	void VKRenderer::BeginRenderPass(vk::SubpassContents contents)
+	{
+		const vk::Extent2D extent = GetTargetExtent();
+		vk::ClearValue clearColor(std::array<float, 4>{0.0f, 0.0f, 0.0f, 1.0f});
+		vk::RenderPassBeginInfo renderPassInfo = vk::RenderPassBeginInfo()
+			.setRenderPass(m_vkRenderPass->Get())
+			.setFramebuffer(GetTargetFramebuffer(m_currentImageIndex))
+			.setRenderArea({ {0, 0}, extent })
+			.setClearValueCount(1)
+			.setPClearValues(&clearColor);
+
+		m_vkFrameContext->GetCommandBuffer().beginRenderPass(renderPassInfo, contents);
+		m_renderPassBegun = true;
+	}
+
+
+	void VKRenderer::BindDrawState(vk::CommandBuffer commandBuffer, const VKPipeline& pipeline) const
+	{
+		// Secondaries inherit no state, every command buffer sets all of it
+		commandBuffer.bindPipeline(vk::PipelineBindPoint::eGraphics, pipeline.GetPipeline());
+
+		const vk::Extent2D extent = GetTargetExtent();
+		vk::Viewport viewport = vk::Viewport()
+			.setX(0.0f)
+			.setY(0.0f)
+			.setWidth(static_cast<float>(extent.width))
+			.setHeight(static_cast<float>(extent.height))
+			.setMinDepth(0.0f)
+			.setMaxDepth(1.0f);
+		commandBuffer.setViewport(0, { viewport });
+
+		vk::Rect2D scissor = vk::Rect2D()
+			.setOffset({ 0, 0 })
+			.setExtent(extent);
+		commandBuffer.setScissor(0, { scissor });
 
-		commandBuffer.draw(3, 1, 0, 0);
+		commandBuffer.pushConstants(pipeline.GetLayout(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(SceneData), &m_sceneData);
+	}
+
+
+	MeshHandle VKRenderer::CreateMesh(const MeshData& mesh)
+	{
+		HE_PROFILE_FUNCTION();
+
+		const uint32_t vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+		const uint32_t indexCount = static_cast<uint32_t>(mesh.Indices.size());
+
+		std::lock_guard lock(m_meshMutex);
+		if (m_meshes.size() >= MaxDrawMeshes) {
+			LOG_RENDER_EXCEPT("VKRenderer: Too many meshes (limit {}).", MaxDrawMeshes);
+		}
+		const vk::DeviceSize vertexOffset = static_cast<vk::DeviceSize>(m_meshVertexCount) * sizeof(MeshVertex);
+		const vk::DeviceSize indexOffset = static_cast<vk::DeviceSize>(m_meshIndexCount) * sizeof(uint32_t);
+		if (vertexOffset + mesh.Vertices.size_bytes() > m_meshVertexBuffer->GetSize() || indexOffset + mesh.Indices.size_bytes() > m_meshIndexBuffer->GetSize()) {
+			LOG_RENDER_EXCEPT("VKRenderer: Mesh pool full ({} vertices, {} indices used), see renderer_vulkan/Draw/MeshPoolVertices and MeshPoolIndices.",
+				m_meshVertexCount, m_meshIndexCount);
+		}
+
+		// Uploaded before the mesh is visible to DrawFrame (see BeginFrame)
+		m_vkUploadManager->Upload(*m_meshVertexBuffer, mesh.Vertices.data(), mesh.Vertices.size_bytes(), vertexOffset);
+		m_vkUploadManager->Upload(*m_meshIndexBuffer, mesh.Indices.data(), mesh.Indices.size_bytes(), indexOffset);
+
+		m_meshes.push_back({ m_meshIndexCount, indexCount, static_cast<int32_t>(m_meshVertexCount) });
+		m_meshVertexCount += vertexCount;
+		m_meshIndexCount += indexCount;
+		return static_cast<MeshHandle>(m_meshes.size() - 1);
+	}
+
+
+	void VKRenderer::CreateMeshPool()
+	{
+		auto& config = ConfigManager::GetInstance();
+		int vertices = std::max(config.Get<int>("renderer_vulkan", "Draw", "MeshPoolVertices", 262144), 1024);
+		int indices = std::max(config.Get<int>("renderer_vulkan", "Draw", "MeshPoolIndices", 1048576), 1024);
+		m_meshVertexBuffer = CreateScope<VKBuffer>(*m_vkDeviceManager, BufferType::Vertex, static_cast<vk::DeviceSize>(vertices) * sizeof(MeshVertex));
+		m_meshIndexBuffer = CreateScope<VKBuffer>(*m_vkDeviceManager, BufferType::Index, static_cast<vk::DeviceSize>(indices) * sizeof(uint32_t));
+
+		// Indirect draws need multi draw and firstInstance (instance data offset)
+		const DeviceFeatureInfo& features = m_vkDeviceManager->GetFeatures();
+		m_indirectSupported = features.multiDrawIndirect && features.drawIndirectFirstInstance;
+		bool indirect = config.Get<bool>("renderer_vulkan", "Draw", "Indirect", true) && m_indirectSupported;
+		m_drawMode = indirect ? DrawMode::Indirect : DrawMode::Direct;
+
+		m_drawFrames.resize(m_framesCount);
+		LOG_RENDER_DEBUG("VKRenderer: Mesh pool created ({} vertices, {} indices), draws use {}.", vertices, indices,
+			DrawModeNames[static_cast<int>(m_drawMode)]);
+	}
+
+
+	void VKRenderer::EnsureDrawCapacity(DrawFrameData& frame, uint32_t instanceCount, uint32_t commandCount)
+	{
+		// The fence of this frame was waited for, its buffers can be replaced
+		if (!frame.Instances || frame.Instances->GetSize() < instanceCount * sizeof(InstanceData)) {
+			vk::DeviceSize size = std::bit_ceil(std::max(instanceCount, MinDrawInstances)) * sizeof(InstanceData);
+			frame.Instances.reset();
+			frame.Instances = CreateScope<VKBuffer>(*m_vkDeviceManager, BufferType::Vertex, size, MemoryUsage::Dynamic);
+		}
+		if (m_drawMode == DrawMode::Direct)
+			return;
+		if (!frame.Commands || frame.Commands->GetSize() < commandCount * sizeof(vk::DrawIndexedIndirectCommand)) {
+			vk::DeviceSize size = std::bit_ceil(std::max(commandCount, MinDrawCommands)) * sizeof(vk::DrawIndexedIndirectCommand);
+			frame.Commands.reset();
+			frame.Commands = CreateScope<VKBuffer>(*m_vkDeviceManager, BufferType::Storage, size, MemoryUsage::Dynamic, vk::BufferUsageFlagBits::eIndirectBuffer);
+		}
+	}
+
+
+	bool VKRenderer::SetDrawMode(DrawMode mode)
+	{
+		if (!IsDrawModeSupported(mode))
+			return false;
+
+		// The command buffers of the other frames in flight are created on their next DrawFrame
+		m_drawMode = mode;
+		LOG_RENDER_DEBUG("VKRenderer: Draws use {}.", DrawModeNames[static_cast<int>(m_drawMode)]);
+		return true;
+	}
+
+
+	const VKPipeline* VKRenderer::ResolvePipeline(PipelineHandle handle) const
+	{
+		// Only the default pipeline so far
+		return (handle == 0) ? m_vkPipeline.get() : nullptr;
+	}
+
+
+	void VKRenderer::RecreateSwapchain()
+	{
+		// Keep the flag while minimized, the extent would be zero
+		if (!m_vkSwapchain || m_Window->glfwIsMinimized())
+			return;
+
+		m_vkDeviceManager->GetLogicalDevice().waitIdle();
+		m_vkSwapchain->Recreate(*m_Window, m_vkRenderPass->Get());
+		m_swapchainOutOfDate.store(false, std::memory_order_release);
 	}
 
 
 	bool VKRenderer::OnFramebufferResize(const FramebufferResizeEvent& e)
 	{
 		LOG_RENDER_DEBUG("VKRenderer: Framebuffer resize event received: {}, {}", e.width, e.height);
-		if (m_vkSwapchain) {
+		if (m_vkSwapchain) { // offscreen images keep their size
 			m_vkDeviceManager->GetLogicalDevice().waitIdle();
 			m_vkSwapchain->Recreate(*m_Window, m_vkRenderPass->Get());
+			if (!m_Window->glfwIsMinimized())
+				m_swapchainOutOfDate.store(false, std::memory_order_release);
 		}
 		return false;
 	}
@@ -260,8 +690,9 @@ namespace Helios::Engine::Renderer::Vulkan {
 	{
 		QueueFamilyIndices queueFamilyIndices = m_vkDeviceManager->GetQueueFamilyIndices();
 
+		// One-off command buffers only (readback), frames record from the VKFrameContext pools
 		vk::CommandPoolCreateInfo poolInfo = vk::CommandPoolCreateInfo()
-			.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer)
+			.setFlags(vk::CommandPoolCreateFlagBits::eTransient)
 			.setQueueFamilyIndex(queueFamilyIndices.graphics.value());
 
 		m_commandPool = m_vkDeviceManager->GetLogicalDevice().createCommandPool(poolInfo);
@@ -269,17 +700,49 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
-	void VKRenderer::CreateCommandBuffers()
+	void VKRenderer::RecycleFrame(uint32_t frame)
 	{
-		m_commandBuffers.resize(m_framesCount);
+		// Everything the frame used is free again after its fence: one reset per pool instead of
+		// per command buffer, staging space, deferred bindless slots and retired pipelines go back
+		HE_PROFILE_FUNCTION();
+		FrameStatScope resetStat(FrameStat::FrameReset);
+
+		m_vkFrameContext->BeginFrame(frame);
+		if (m_vkParallelRecorder)
+			m_vkParallelRecorder->BeginFrame(frame);
+		m_vkUploadManager->BeginFrame(frame);
+		if (m_vkBindlessHeap)
+			m_vkBindlessHeap->BeginFrame(frame);
+
+		DrawFrameData& data = m_drawFrames[frame];
+		data.RetiredPipelines.clear();
+		for (vk::ShaderModule module : data.RetiredShaderModules)
+			m_vkDeviceManager->GetLogicalDevice().destroyShaderModule(module);
+		data.RetiredShaderModules.clear();
+
+		// Shader modules a hot reload replaced: a build holding one was started before the count was
+		// read, so none is pending once the reload jobs and compiles are done. They go with this slot.
+		const size_t retiredModules = m_vkShaderCache->GetRetiredCount();
+		if (retiredModules > 0 && m_reloadJobs.IsDone() && m_vkPipelineLibrary->GetPendingCount() == 0)
+			m_vkShaderCache->TakeRetired(retiredModules, data.RetiredShaderModules);
+	}
 
-		vk::CommandBufferAllocateInfo allocInfo = vk::CommandBufferAllocateInfo()
-			.setCommandPool(m_commandPool)
-			.setLevel(vk::CommandBufferLevel::ePrimary)
-			.setCommandBufferCount((uint32_t)m_commandBuffers.size());
 
-		m_commandBuffers = m_vkDeviceManager->GetLogicalDevice().allocateCommandBuffers(allocInfo);
-		LOG_RENDER_DEBUG("VKRenderer: Command buffers allocated.");
+	void VKRenderer::CreateParallelRecorder()
+	{
+		// Recording slots (0 = one per job system worker plus the render thread)
+		auto& config = ConfigManager::GetInstance();
+		int threads = config.Get<int>("renderer_vulkan", "Draw", "RecordThreads", 0);
+		JobSystem* jobs = JobSystem::Get();
+		uint32_t slots = (threads > 0) ? static_cast<uint32_t>(threads) : (jobs ? jobs->GetWorkerCount() + 1 : 1);
+		slots = std::min(slots, MaxRecordSlots);
+		m_parallelMinDraws = static_cast<uint32_t>(std::max(config.Get<int>("renderer_vulkan", "Draw", "ParallelMinDraws", 1024), 1));
+
+		if (slots < 2) {
+			LOG_RENDER_DEBUG("VKRenderer: Draws are recorded inline (single recording thread).");
+			return;
+		}
+		m_vkParallelRecorder = CreateScope<VKParallelRecorder>(*m_vkDeviceManager, static_cast<uint32_t>(m_framesCount), slots);
 	}
 
 
@@ -302,20 +765,99 @@ namespace Helios::Engine::Renderer::Vulkan {
 	}
 
 
+	void VKRenderer::CreateTimestampQueries()
+	{
+		vk::PhysicalDevice physicalDevice = m_vkDeviceManager->GetPhysicalDevice();
+		uint32_t graphicsFamily = m_vkDeviceManager->GetGraphicsQueueIndex();
+
+		uint32_t validBits = physicalDevice.getQueueFamilyProperties()[graphicsFamily].timestampValidBits;
+		m_timestampPeriod = static_cast<double>(physicalDevice.getProperties().limits.timestampPeriod);
+		if (validBits == 0 || m_timestampPeriod <= 0.0) {
+			LOG_RENDER_INFO("VKRenderer: Timestamp queries not supported on the graphics queue, no GPU frame times.");
+			return;
+		}
+		m_timestampMask = (validBits >= 64) ? UINT64_MAX : ((1ull << validBits) - 1);
+
+		vk::QueryPoolCreateInfo poolInfo = vk::QueryPoolCreateInfo()
+			.setQueryType(vk::QueryType::eTimestamp)
+			.setQueryCount(static_cast<uint32_t>(m_framesCount) * 2);
+		m_timestampPool = m_vkDeviceManager->GetLogicalDevice().createQueryPool(poolInfo);
+		m_timestampsWritten.assign(m_framesCount, false);
+		LOG_RENDER_DEBUG("VKRenderer: Timestamp query pool created ({} ns per tick).", m_timestampPeriod);
+	}
+
+
+	void VKRenderer::ReadTimestamps(uint32_t frame)
+	{
+		if (!m_timestampPool || !m_timestampsWritten[frame])
+			return;
+
+		// The fence of this frame was waited for, so the results are ready without waiting
+		std::array<uint64_t, 2> ticks = {};
+		vk::Result result = m_vkDeviceManager->GetLogicalDevice().getQueryPoolResults(m_timestampPool, frame * 2, 2,
+			sizeof(ticks), ticks.data(), sizeof(uint64_t), vk::QueryResultFlagBits::e64);
+		m_timestampsWritten[frame] = false;
+		if (result != vk::Result::eSuccess)
+			return;
+
+		uint64_t delta = ((ticks[1] & m_timestampMask) - (ticks[0] & m_timestampMask)) & m_timestampMask;
+		double seconds = static_cast<double>(delta) * m_timestampPeriod * 1e-9;
+		m_gpuFrameTime = seconds * 1000.0;
+		FrameStats::Record(FrameStat::GpuFrame, Clock::SecondsToTicks(seconds));
+	}
+
+
+	vk::Extent2D VKRenderer::GetTargetExtent() const
+	{
+		return m_headless ? m_vkOffscreenTarget->GetExtent() : m_vkSwapchain->GetExtent();
+	}
+
+
+	vk::Format VKRenderer::GetTargetFormat() const
+	{
+		return m_headless ? m_vkOffscreenTarget->GetImageFormat() : m_vkSwapchain->GetImageFormat();
+	}
+
+
+	vk::Framebuffer VKRenderer::GetTargetFramebuffer(uint32_t imageIndex) const
+	{
+		return m_headless ? m_vkOffscreenTarget->GetFramebuffers()[imageIndex]->Get() : m_vkSwapchain->GetFramebuffers()[imageIndex]->Get();
+	}
+
+
+	bool VKRenderer::ReadbackFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height)
+	{
+		HE_PROFILE_FUNCTION();
+
+		if (!m_headless || m_lastImageIndex == UINT32_MAX) {
+			return false;
+		}
+
+		m_vkDeviceManager->GetLogicalDevice().waitIdle();
+		if (!m_vkOffscreenTarget->Readback(m_commandPool, m_vkDeviceManager->GetGraphicsQueue(), m_lastImageIndex, pixels)) {
+			return false;
+		}
+
+		width = m_vkOffscreenTarget->GetExtent().width;
+		height = m_vkOffscreenTarget->GetExtent().height;
+		return true;
+	}
+
+
 	void VKRenderer::CreateSimpleRenderPass()
 	{
 		VKRenderPassBuilder builder(*m_vkDeviceManager);
 
-		// Color attachment for the swapchain image
+		// Color attachment for the swapchain (or offscreen) image
 		vk::AttachmentDescription colorAttachment = vk::AttachmentDescription()
-			.setFormat(m_vkSwapchain->GetImageFormat())
+			.setFormat(GetTargetFormat())
 			.setSamples(vk::SampleCountFlagBits::e1)
 			.setLoadOp(vk::AttachmentLoadOp::eClear)
 			.setStoreOp(vk::AttachmentStoreOp::eStore)
 			.setStencilLoadOp(vk::AttachmentLoadOp::eDontCare)
 			.setStencilStoreOp(vk::AttachmentStoreOp::eDontCare)
 			.setInitialLayout(vk::ImageLayout::eUndefined)
-			.setFinalLayout(vk::ImageLayout::ePresentSrcKHR);
+			.setFinalLayout(m_headless ? vk::ImageLayout::eTransferSrcOptimal : vk::ImageLayout::ePresentSrcKHR);
 
 		builder.AddAttachment(colorAttachment);
 
@@ -338,11 +880,39 @@ namespace Helios::Engine::Renderer::Vulkan {
 
 		builder.AddDependency(dependency);
 
+		// Headless: the readback copies the image in a later submission, make the color writes visible to it
+		if (m_headless) {
+			vk::SubpassDependency readbackDependency = vk::SubpassDependency()
+				.setSrcSubpass(0)
+				.setDstSubpass(VK_SUBPASS_EXTERNAL)
+				.setSrcStageMask(vk::PipelineStageFlagBits::eColorAttachmentOutput)
+				.setDstStageMask(vk::PipelineStageFlagBits::eTransfer)
+				.setSrcAccessMask(vk::AccessFlagBits::eColorAttachmentWrite)
+				.setDstAccessMask(vk::AccessFlagBits::eTransferRead);
+
+			builder.AddDependency(readbackDependency);
+		}
+
 		m_vkRenderPass = builder.Build();
 	}
 
 
 	void VKRenderer::CreateSimpleGraphicsPipeline()
+	{
+		Scope<VKPipelineBuilder> builder = CreateSimplePipelineBuilder();
+		m_vkPipeline = m_vkPipelineLibrary->GetOrCreate(*builder);
+		m_vkPipelineKey = builder->ComputeHash();
+
+		// Hot reload watches the sources the pipeline was built from
+		if (m_shaderWatcher) {
+			auto onChange = [this](const std::string& path) { OnShaderSourceChanged(path); };
+			m_shaderWatcher->Watch("@shader_src:/simple.vert.glsl", onChange);
+			m_shaderWatcher->Watch("@shader_src:/simple.frag.glsl", onChange);
+		}
+	}
+
+
+	Scope<VKPipelineBuilder> VKRenderer::CreateSimplePipelineBuilder()
 	{
 		// Viewport and scissor will be dynamic
 		vk::Viewport viewport = {};
@@ -359,9 +929,29 @@ namespace Helios::Engine::Renderer::Vulkan {
 			.setOffset(0)
 			.setSize(sizeof(SceneData));
 
-		VKPipelineBuilder builder(*m_vkDeviceManager, *m_vkRenderPass);
-		builder.SetShaders("@assets:/shaders/vulkan/simple.vert.spv", "@assets:/shaders/vulkan/simple.frag.spv")
-			.SetVertexInput({}, {}) // No vertex input for now
+		// Interleaved MeshVertex (binding 0) and per-instance InstanceData (binding 1, mat4 = 4 locations)
+		std::vector<vk::VertexInputBindingDescription> vertexBindings = {
+			{ 0, sizeof(MeshVertex), vk::VertexInputRate::eVertex },
+			{ 1, sizeof(InstanceData), vk::VertexInputRate::eInstance },
+		};
+		std::vector<vk::VertexInputAttributeDescription> vertexAttributes = {
+			{ 0, 0, vk::Format::eR32G32B32Sfloat, offsetof(MeshVertex, Position) },
+			{ 1, 0, vk::Format::eR32G32B32Sfloat, offsetof(MeshVertex, Color) },
+			{ 2, 1, vk::Format::eR32G32B32A32Sfloat, offsetof(InstanceData, Transform) + 0 * sizeof(glm::vec4) },
+			{ 3, 1, vk::Format::eR32G32B32A32Sfloat, offsetof(InstanceData, Transform) + 1 * sizeof(glm::vec4) },
+			{ 4, 1, vk::Format::eR32G32B32A32Sfloat, offsetof(InstanceData, Transform) + 2 * sizeof(glm::vec4) },
+			{ 5, 1, vk::Format::eR32G32B32A32Sfloat, offsetof(InstanceData, Transform) + 3 * sizeof(glm::vec4) },
+			{ 6, 1, vk::Format::eR32G32B32A32Sfloat, offsetof(InstanceData, Color) },
+		};
+
+		// Compiled SPIR-V from the build, or the GLSL sources (see Init)
+		bool fromSource = VirtFS.HasAlias("@shader_src:");
+		std::string vertShader = fromSource ? "@shader_src:/simple.vert.glsl" : "@assets:/shaders/vulkan/simple.vert.spv";
+		std::string fragShader = fromSource ? "@shader_src:/simple.frag.glsl" : "@assets:/shaders/vulkan/simple.frag.spv";
+
+		auto builder = CreateScope<VKPipelineBuilder>(*m_vkDeviceManager, *m_vkRenderPass, *m_vkPipelineCache, *m_vkShaderCache);
+		builder->SetShaders(vertShader, fragShader)
+			.SetVertexInput(vertexBindings, vertexAttributes)
 			.SetInputAssembly(vk::PrimitiveTopology::eTriangleList)
 			.SetViewport(viewport)
 			.SetScissor(scissor)
@@ -371,7 +961,76 @@ namespace Helios::Engine::Renderer::Vulkan {
 			.SetDepthStencil(VK_FALSE, VK_FALSE, vk::CompareOp::eLess)
 			.SetDynamicState({ vk::DynamicState::eViewport, vk::DynamicState::eScissor })
 			.SetPushConstantRanges({ pushConstantRange });
-		m_vkPipeline = builder.Build();
+		return builder;
+	}
+
+
+	void VKRenderer::CreateSimpleGeometry()
+	{
+		const std::array<MeshVertex, 3> vertices = { {
+			{ {  0.0f, -0.5f, 0.0f }, { 1.0f, 0.0f, 0.0f } },
+			{ {  0.5f,  0.5f, 0.0f }, { 0.0f, 1.0f, 0.0f } },
+			{ { -0.5f,  0.5f, 0.0f }, { 0.0f, 0.0f, 1.0f } },
+		} };
+		const std::array<uint32_t, 3> indices = { 0, 1, 2 };
+
+		// Mesh 0 (see Renderer::CreateMesh), the copies go out with the first frame
+		CreateMesh({ vertices, indices });
+	}
+
+
+	void VKRenderer::OnShaderSourceChanged(const std::string& path)
+	{
+		LOG_RENDER_INFO("VKRenderer: Shader '{}' changed, recompiling...", path);
+		m_vkShaderCache->Invalidate(path);
+
+		// GLSL compile (in SetShaders) and pipeline build both stay off the render thread
+		auto reload = [this] {
+			try {
+				PipelineKey key = m_vkPipelineLibrary->Request(CreateSimplePipelineBuilder());
+				m_reloadPipelineKey.store(key, std::memory_order_release);
+			}
+			catch (const std::exception& e) {
+				LOG_RENDER_ERROR("VKRenderer: Shader reload failed, keeping the current pipeline: {}", e.what());
+			}
+		};
+
+		if (JobSystem* jobs = JobSystem::Get())
+			jobs->Run(reload, &m_reloadJobs);
+		else
+			reload();
+	}
+
+
+	void VKRenderer::ApplyReloadedPipeline()
+	{
+		PipelineKey key = m_reloadPipelineKey.load(std::memory_order_acquire);
+		if (key == 0)
+			return;
+
+		switch (m_vkPipelineLibrary->GetStatus(key)) {
+			case PipelineStatus::Ready:
+				if (key != m_vkPipelineKey) {
+					// Frames in flight may still use the old pipeline: it lives until this slot comes around
+					// again (all earlier frames have finished by then), the library forgets it right away
+					m_drawFrames[m_currentFrame].RetiredPipelines.push_back(std::move(m_vkPipeline));
+					m_vkPipelineLibrary->Release(m_vkPipelineKey);
+					m_vkPipeline = m_vkPipelineLibrary->Get(key);
+					m_vkPipelineKey = key;
+				}
+				LOG_RENDER_INFO("VKRenderer: Pipeline {:016x} hot reloaded.", key);
+				break;
+			case PipelineStatus::Failed:
+				// Nothing references the failed entry, a later reload with the same sources compiles it again
+				m_vkPipelineLibrary->Release(key);
+				LOG_RENDER_ERROR("VKRenderer: Reloaded pipeline {:016x} failed, keeping the current one.", key);
+				break;
+			default:
+				return; // still compiling
+		}
+
+		// Only clear the key we handled, a newer reload may have replaced it meanwhile
+		m_reloadPipelineKey.compare_exchange_strong(key, 0, std::memory_order_acq_rel);
 	}
 
 
@@ -14,9 +14,47 @@
 // - Manages the lifecycle of core Vulkan objects (Instance, Surface, Device, etc.).
 // - Coordinates the initialization and shutdown of the Vulkan API.
 // - Handles events, such as window resizing, to recreate the swapchain.
+// - Headless mode: renders into VKOffscreenTarget images instead of a swapchain.
+// - GPU frame time via timestamp queries (FrameStat::GpuFrame).
+// - Shader hot reload: changed GLSL sources are recompiled in the background,
+//   the new pipeline replaces the old one after the next fence wait.
+// - Draw submission: the packet's DrawList is sorted (DrawSorter), instance
+//   data is written in draw order into a per-frame buffer and every
+//   pipeline range becomes one vkCmdDrawIndexedIndirect call. All
+//   meshes share one vertex/index pool, so nothing is rebound per draw.
+// - Parallel recording: large frames are split into chunks recorded into
+//   secondary command buffers on the job system (VKParallelRecorder, per
+//   frame and slot command pools), executed by the primary at EndFrame.
+// - Per-frame resources are recycled in one place after the frame fence
+//   (RecycleFrame): the command pool of the VKFrameContext, secondaries,
+//   staging memory, bindless slots, retired pipelines and shader modules
+//   (FrameStat::FrameReset).
 // - Serves as the central hub for Vulkan-specific rendering logic.
 // 
 // Changelog:
+// - 2026.10: Bindless heap kept out of the pipeline layouts and draws until a shader uses set 0
+// - 2026.10: Shader modules replaced by a hot reload are destroyed once their frames finished
+// - 2026.10: Dropped the indirect count draw mode, draw mode switchable at runtime (SetDrawMode)
+// - 2026.10: Parallel recording chunks draw commands in every draw mode (GetRecordSlotCount, GetParallelMinDraws)
+// - 2026.10: Added GetDeviceManager (tools and benchmarks reach the device objects through it)
+// - 2026.10: Pipelines replaced by a hot reload are released once their frames finished
+// - 2026.10: Headless render pass makes its color writes visible to the readback copy
+// - 2026.10: Out-of-date swapchains are flagged and recreated on the main thread (RecreateSwapchain)
+// - 2026.10: Frame command buffers from per-frame transient pools (VKFrameContext), reset as a whole
+// - 2026.10: Draws recorded in parallel into secondary command buffers, render pass begins in DrawFrame
+// - 2026.10: Sorted, instanced draws from FramePacket::Draws via indirect (count) buffers, mesh pool
+// - 2026.10: Bindless descriptor heap bound for all draws (descriptor indexing devices)
+// - 2026.10: Triangle drawn from vertex/index buffers uploaded through the VKUploadManager
+// - 2026.10: Memory budget updated once per frame (VKMemoryAllocator)
+// - 2026.10: Added shader hot reload (GLSL sources watched through the VFS)
+// - 2026.10: Added shader module cache, GLSL sources via renderer_vulkan/ShaderCache/SourcePath
+// - 2026.10: Pipelines are shared through a VKPipelineLibrary
+// - 2026.10: Added persistent pipeline cache
+// - 2026.10: Added headless rendering (offscreen target, readback) and GPU timestamps
+// - 2026.10: Added GetFramesInFlight
+// - 2026.10: Allocations accounted to memory tag "Renderer"
+// - 2026.10: Records fence wait, submit and present times in FrameStats
+// - 2026.10: BeginFrame consumes a FramePacket (render thread support)
 // - 2026.01: Added Camera support to BeginFrame
 // - 2026.01: Refactored rendering loop into BeginFrame/DrawFrame/EndFrame
 // - 2026.01: Added basic rendering loop with command buffers and synchronization
@@ -39,9 +77,21 @@
 #include "Helios/Platform/Renderer/Vulkan/VKSurface.h"
 #include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
 #include "Helios/Platform/Renderer/Vulkan/VKSwapchain.h"
+#include "Helios/Platform/Renderer/Vulkan/VKOffscreenTarget.h"
 #include "Helios/Platform/Renderer/Vulkan/VKRenderPass.h"
 #include "Helios/Platform/Renderer/Vulkan/VKPipeline.h"
+#include "Helios/Platform/Renderer/Vulkan/VKPipelineCache.h"
+#include "Helios/Platform/Renderer/Vulkan/VKPipelineLibrary.h"
+#include "Helios/Platform/Renderer/Vulkan/VKShaderCache.h"
 #include "Helios/Platform/Renderer/Vulkan/VKFramebuffer.h"
+#include "Helios/Platform/Renderer/Vulkan/VKBuffer.h"
+#include "Helios/Platform/Renderer/Vulkan/VKUploadManager.h"
+#include "Helios/Platform/Renderer/Vulkan/VKBindlessHeap.h"
+#include "Helios/Platform/Renderer/Vulkan/VKParallelRecorder.h"
+#include "Helios/Platform/Renderer/Vulkan/VKFrameContext.h"
+
+#include "Helios/Engine/Core/JobSystem.h"
+#include "Helios/Engine/VFS/FileWatcher.h"
 
 namespace Helios::Engine::Renderer::Vulkan {
 
@@ -49,28 +99,74 @@ namespace Helios::Engine::Renderer::Vulkan {
 	class VKRenderer : public Renderer
 	{
 	public:
+		// Direct draws are the fallback without multi draw indirect / indirect firstInstance
+		enum class DrawMode { Direct, Indirect };
+
 		VKRenderer() = default;
 		virtual ~VKRenderer() = default;
 
-		virtual void Init(const AppSpec& appSpec, Window& window) override;
+		virtual void Init(const AppSpec& appSpec, Window* window) override;
 		virtual void Shutdown() override;
 
 		virtual void OnEvent(Event& e) override;
 
-		virtual bool BeginFrame(Camera& camera) override;
+		virtual bool BeginFrame(const FramePacket& packet) override;
 		virtual void EndFrame() override;
 		virtual void DrawFrame() override;
 
+		virtual uint32_t GetFramesInFlight() const override { return static_cast<uint32_t>(m_framesCount); }
+		virtual double GetGpuFrameTime() const override { return m_gpuFrameTime; }
+		virtual bool ReadbackFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) override;
+
+		virtual MeshHandle CreateMesh(const MeshData& mesh) override;
+		virtual DrawStats GetDrawStats() const override { return m_drawStats; }
+
+		virtual bool IsSwapchainOutOfDate() const override { return m_swapchainOutOfDate.load(std::memory_order_acquire); }
+		virtual void RecreateSwapchain() override;
+
+		// --- Accessors ---
+		const VKDeviceManager& GetDeviceManager() const { return *m_vkDeviceManager; }
+		uint32_t GetRecordSlotCount() const { return m_vkParallelRecorder ? m_vkParallelRecorder->GetSlotCount() : 1; }
+		uint32_t GetParallelMinDraws() const { return m_parallelMinDraws; }
+		DrawMode GetDrawMode() const { return m_drawMode; }
+		bool IsDrawModeSupported(DrawMode mode) const { return mode == DrawMode::Direct || m_indirectSupported; }
+
+		// Between frames, on the thread recording them (tools and benchmarks), false if unsupported
+		bool SetDrawMode(DrawMode mode);
+
 	private:
 		bool OnFramebufferResize(const FramebufferResizeEvent& e);
 
 		void CreateCommandPool();
-		void CreateCommandBuffers();
+		void RecycleFrame(uint32_t frame);
+		void CreateParallelRecorder();
 		void CreateSyncObjects();
+		void CreateTimestampQueries();
+		void ReadTimestamps(uint32_t frame);
+
+		// Render target of the current mode (swapchain or offscreen images)
+		vk::Extent2D GetTargetExtent() const;
+		vk::Format GetTargetFormat() const;
+		vk::Framebuffer GetTargetFramebuffer(uint32_t imageIndex) const;
 
 		// Tempoary
 		void CreateSimpleRenderPass();
 		void CreateSimpleGraphicsPipeline();
+		Scope<VKPipelineBuilder> CreateSimplePipelineBuilder();
+		void CreateSimpleGeometry();
+
+		// Draw submission
+		struct DrawFrameData;
+		void CreateMeshPool();
+		void EnsureDrawCapacity(DrawFrameData& frame, uint32_t instanceCount, uint32_t commandCount);
+		const VKPipeline* ResolvePipeline(PipelineHandle handle) const;
+		uint32_t RecordDraws(vk::CommandBuffer commandBuffer, const DrawFrameData& frame, uint32_t begin, uint32_t end) const; // returns the draw calls
+		void BeginRenderPass(vk::SubpassContents contents);
+		void BindDrawState(vk::CommandBuffer commandBuffer, const VKPipeline& pipeline) const;
+
+		// Shader hot reload
+		void OnShaderSourceChanged(const std::string& path);
+		void ApplyReloadedPipeline();
 
 	private:
 		struct SceneData {
@@ -79,16 +175,78 @@ namespace Helios::Engine::Renderer::Vulkan {
 		};
 		SceneData m_sceneData;
 
+		// Per-instance vertex input (binding 1), written in draw order
+		struct InstanceData {
+			glm::mat4 Transform;
+			glm::vec4 Color;
+		};
+
+		// Location of a mesh in the shared pool
+		struct MeshRange {
+			uint32_t FirstIndex = 0;
+			uint32_t IndexCount = 0;
+			int32_t VertexOffset = 0;
+		};
+
+		// Consecutive commands using the same pipeline (one indirect call)
+		struct DrawRange {
+			PipelineHandle Pipeline = 0;
+			uint32_t FirstCommand = 0;
+			uint32_t CommandCount = 0;
+		};
+
+		// Host visible, one set per frame in flight (rewritten after the frame's fence)
+		struct DrawFrameData {
+			Scope<VKBuffer> Instances;  // InstanceData
+			Scope<VKBuffer> Commands;   // vk::DrawIndexedIndirectCommand
+			std::vector<Ref<VKPipeline>> RetiredPipelines; // replaced while in flight, dropped when the slot is recycled
+			std::vector<vk::ShaderModule> RetiredShaderModules; // replaced by a hot reload, destroyed when the slot is recycled
+		};
+
 		Window* m_Window = nullptr;
 		Scope<VKInstance> m_vkInstance;
 		Scope<VKSurface> m_vkSurface;
 		Scope<VKDeviceManager> m_vkDeviceManager;
 		Scope<VKSwapchain> m_vkSwapchain;
+		Scope<VKOffscreenTarget> m_vkOffscreenTarget; // headless only
 		Scope<VKRenderPass> m_vkRenderPass;
-		Scope<VKPipeline> m_vkPipeline;
+		Scope<VKPipelineCache> m_vkPipelineCache;
+		Scope<VKShaderCache> m_vkShaderCache;
+		Scope<VKPipelineLibrary> m_vkPipelineLibrary;
+		Scope<VKBindlessHeap> m_vkBindlessHeap; // nullptr without descriptor indexing, not bound by the simple pipeline
+		Ref<VKPipeline> m_vkPipeline;
+		PipelineKey m_vkPipelineKey = 0;       // library key of m_vkPipeline
+		Scope<VKUploadManager> m_vkUploadManager;
+		vk::Semaphore m_uploadSemaphore; // upload batch the current frame waits for
 
-		vk::CommandPool m_commandPool;
-		std::vector<vk::CommandBuffer> m_commandBuffers;
+		// Mesh pool (MeshVertex / uint32 indices), filled by CreateMesh from any thread
+		Scope<VKBuffer> m_meshVertexBuffer;
+		Scope<VKBuffer> m_meshIndexBuffer;
+		uint32_t m_meshVertexCount = 0;
+		uint32_t m_meshIndexCount = 0;
+		std::vector<MeshRange> m_meshes;
+		uint32_t m_readyMeshCount = 0; // meshes whose upload goes out with the current frame
+		std::mutex m_meshMutex;
+
+		// Draw submission
+		const DrawList* m_drawList = nullptr; // packet of the current frame
+		DrawSorter m_drawSorter;
+		std::vector<DrawRange> m_drawRanges;
+		std::vector<vk::DrawIndexedIndirectCommand> m_drawCommands;
+		std::vector<DrawFrameData> m_drawFrames;
+		DrawMode m_drawMode = DrawMode::Direct;
+		bool m_indirectSupported = false;
+		Scope<VKParallelRecorder> m_vkParallelRecorder; // nullptr with a single recording slot
+		uint32_t m_parallelMinDraws = 1024;             // draw commands per chunk at least
+		std::vector<uint32_t> m_chunkDrawCalls;
+		DrawStats m_drawStats;
+
+		Scope<VFS::FileWatcher> m_shaderWatcher;           // only with GLSL sources
+		std::atomic<PipelineKey> m_reloadPipelineKey = 0;  // 0 = no reload pending
+		JobCounter m_reloadJobs;
+
+		vk::CommandPool m_commandPool;         // one-off command buffers
+		Scope<VKFrameContext> m_vkFrameContext; // per-frame command pools and primary command buffers
 
 		int m_framesCount = 0;
 		std::vector<vk::Semaphore> m_imageAvailableSemaphores;
@@ -98,6 +256,19 @@ namespace Helios::Engine::Renderer::Vulkan {
 		uint32_t m_currentImageIndex = 0;
 
 		bool m_stateBeginFrameSuccess = false;
+		bool m_renderPassBegun = false;
+		uint64_t m_frameBeginTicks = 0; // end of the fence wait (FrameStats)
+
+		bool m_headless = false;
+		std::atomic<bool> m_swapchainOutOfDate = false; // set by acquire/present, cleared on the main thread
+		uint32_t m_lastImageIndex = UINT32_MAX; // last submitted offscreen image (readback)
+
+		// GPU timestamps, two queries (begin/end) per frame in flight
+		vk::QueryPool m_timestampPool;
+		std::vector<bool> m_timestampsWritten;
+		double m_timestampPeriod = 0.0; // ns per tick
+		uint64_t m_timestampMask = 0;
+		double m_gpuFrameTime = 0.0; // ms
 	};
 
 
@@ -0,0 +1,343 @@
+//==============================================================================
+// Vulkan Shader Module Cache (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Further information in the corresponding header file VKShaderCache.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKShaderCache.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+#include "Helios/Engine/Core/Config.h"
+#include "Helios/Engine/Util/Hash.h"
+#include "Helios/Engine/VFS/VFS.h"
+
+#include <Helios/Platform/PlatformDetection.h>
+#if defined TARGET_PLATFORM_WINDOWS
+#	include "Helios/Platform/System/Windows/WinUtil.h"
+#elif defined TARGET_PLATFORM_LINUX
+#	include "Helios/Platform/System/Linux/LinuxUtil.h"
+#elif defined TARGET_PLATFORM_MACOS
+#	include "Helios/Platform/System/MacOS/MacOSUtil.h"
+#endif
+
+#include <fstream>
+#include <sstream>
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	namespace {
+
+		// Flags that change the generated SPIR-V, part of the cooked cache key
+		constexpr std::string_view CompilerFlags = "-V";
+
+		// Nesting limit of #include (also stops include cycles)
+		constexpr uint32_t MaxIncludeDepth = 16;
+
+		// 'name' from a line of the form  #include "name", empty for any other line
+		std::string_view ParseInclude(std::string_view line)
+		{
+			size_t pos = line.find_first_not_of(" \t");
+			if (pos == std::string_view::npos || line.compare(pos, 8, "#include") != 0)
+				return {};
+			size_t begin = line.find('"', pos + 8);
+			size_t end = (begin == std::string_view::npos) ? begin : line.find('"', begin + 1);
+			if (end == std::string_view::npos)
+				return {};
+			return line.substr(begin + 1, end - begin - 1);
+		}
+
+	} // anonymous namespace
+
+
+	VKShaderCache::VKShaderCache(const VKDeviceManager& deviceManager)
+		: m_deviceManager(deviceManager)
+	{
+		std::string defaultCompiler = "glslangValidator";
+		if (const char* sdk = std::getenv("VULKAN_SDK")) {
+#if defined TARGET_PLATFORM_WINDOWS
+			defaultCompiler = std::string(sdk) + "/Bin/glslangValidator.exe";
+#else
+			defaultCompiler = std::string(sdk) + "/bin/glslangValidator";
+#endif
+		}
+		auto& config = ConfigManager::GetInstance();
+		m_compiler = config.Get<std::string>("renderer_vulkan", "ShaderCache", "Compiler", defaultCompiler);
+		m_compilerTimeoutMs = static_cast<uint32_t>(std::max(config.Get<int>("renderer_vulkan", "ShaderCache", "CompilerTimeoutMs", 30000), 100));
+	}
+
+
+	VKShaderCache::~VKShaderCache()
+	{
+		Clear();
+	}
+
+
+	void VKShaderCache::Clear()
+	{
+		std::lock_guard lock(m_mutex);
+
+		if (!m_modules.empty()) {
+			for (auto& [hash, module] : m_modules)
+				m_deviceManager.GetLogicalDevice().destroyShaderModule(module);
+			LOG_RENDER_DEBUG("VKShaderCache: {} shader module(s) destroyed ({} hits, {} misses, {} compiles).",
+				m_modules.size(), GetHits(), GetMisses(), GetCompiles());
+		}
+		for (vk::ShaderModule module : m_retired)
+			m_deviceManager.GetLogicalDevice().destroyShaderModule(module);
+		m_modules.clear();
+		m_pathHashes.clear();
+		m_retired.clear();
+	}
+
+
+	void VKShaderCache::Invalidate(const std::string& path)
+	{
+		std::lock_guard lock(m_mutex);
+
+		auto it = m_pathHashes.find(path);
+		if (it == m_pathHashes.end())
+			return;
+		const uint64_t hash = it->second;
+		m_pathHashes.erase(it);
+
+		// Equal code loaded from another path keeps the module
+		for (const auto& [otherPath, otherHash] : m_pathHashes) {
+			if (otherHash == hash)
+				return;
+		}
+
+		auto module = m_modules.find(hash);
+		if (module != m_modules.end()) {
+			m_retired.push_back(module->second);
+			m_modules.erase(module);
+		}
+	}
+
+
+	size_t VKShaderCache::GetRetiredCount()
+	{
+		std::lock_guard lock(m_mutex);
+		return m_retired.size();
+	}
+
+
+	void VKShaderCache::TakeRetired(size_t count, std::vector<vk::ShaderModule>& out)
+	{
+		std::lock_guard lock(m_mutex);
+
+		count = std::min(count, m_retired.size());
+		out.insert(out.end(), m_retired.begin(), m_retired.begin() + count);
+		m_retired.erase(m_retired.begin(), m_retired.begin() + count);
+	}
+
+
+	VKShaderModuleInfo VKShaderCache::GetModule(const std::string& path)
+	{
+		HE_PROFILE_FUNCTION();
+
+		// Known path: no file access
+		{
+			std::lock_guard lock(m_mutex);
+			auto it = m_pathHashes.find(path);
+			if (it != m_pathHashes.end()) {
+				m_hits.fetch_add(1, std::memory_order_relaxed);
+				return { m_modules.at(it->second), it->second };
+			}
+		}
+
+		bool isGlsl = path.size() > 5 && path.compare(path.size() - 5, 5, ".glsl") == 0;
+		std::vector<uint8_t> code = isGlsl ? CompileGlsl(path) : VirtFS.ReadBinary(path);
+		if (code.empty() || (code.size() % 4) != 0) {
+			LOG_RENDER_EXCEPT("VKShaderCache: Failed to load shader: '{}'", path);
+		}
+		uint64_t hash = Util::HashFnv1a(code);
+
+		std::lock_guard lock(m_mutex);
+		m_pathHashes[path] = hash;
+
+		// Same code under another path (or reloaded without changes)
+		auto it = m_modules.find(hash);
+		if (it != m_modules.end()) {
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+			return { it->second, hash };
+		}
+
+		m_misses.fetch_add(1, std::memory_order_relaxed);
+		vk::ShaderModuleCreateInfo createInfo = vk::ShaderModuleCreateInfo()
+			.setCodeSize(code.size())
+			.setPCode(reinterpret_cast<const uint32_t*>(code.data()));
+		vk::ShaderModule module = m_deviceManager.GetLogicalDevice().createShaderModule(createInfo);
+		m_modules.emplace(hash, module);
+		LOG_RENDER_DEBUG("VKShaderCache: Shader module created for '{}' ({:016x}).", path, hash);
+		return { module, hash };
+	}
+
+
+	std::vector<uint8_t> VKShaderCache::CompileGlsl(const std::string& path)
+	{
+		HE_PROFILE_FUNCTION();
+
+		// Included files are inlined, so the key below covers their contents as well
+		std::string source;
+		if (!ExpandIncludes(path, source, 0))
+			return {};
+
+		// The stage is part of the key, the same text may be valid for several stages, and so is the
+		// compiler (another version or flags produce other SPIR-V)
+		const std::string stage = GetStage(path);
+		uint64_t sourceHash = Util::HashFnv1a(stage, Util::HashFnv1a(source, GetCompilerHash()));
+		std::string cookedPath = fmt::format("@cache:/shaders/{:016x}.spv", sourceHash);
+
+		if (VirtFS.Exists(cookedPath)) {
+			std::vector<uint8_t> cooked = VirtFS.ReadBinary(cookedPath);
+			if (!cooked.empty()) {
+				LOG_RENDER_DEBUG("VKShaderCache: '{}' taken from the cooked cache.", path);
+				return cooked;
+			}
+		}
+
+		std::vector<uint8_t> spirv = RunCompiler(source, stage, VirtFS.GetFileName(path));
+		if (spirv.empty())
+			return {};
+
+		m_compiles.fetch_add(1, std::memory_order_relaxed);
+		VirtFS.CreateDirectories("@cache:/shaders");
+		if (!VirtFS.WriteBinary(cookedPath, spirv))
+			LOG_RENDER_WARN("VKShaderCache: Failed to store '{}'.", cookedPath);
+		return spirv;
+	}
+
+
+	std::vector<uint8_t> VKShaderCache::RunCompiler(const std::string& source, const std::string& stage, const std::string& name)
+	{
+		HE_PROFILE_FUNCTION();
+
+		if (stage.empty()) {
+			LOG_RENDER_ERROR("VKShaderCache: Unknown shader stage for '{}' (expected *.<stage>.glsl).", name);
+			return {};
+		}
+
+		// The compiler works on physical files, use a unique temporary pair
+		static std::atomic<uint32_t> s_counter = 0;
+		std::filesystem::path tempDir = std::filesystem::temp_directory_path();
+		std::string tempName = fmt::format("helios_{}_{}", std::hash<std::thread::id>{}(std::this_thread::get_id()), s_counter.fetch_add(1));
+		std::filesystem::path input = tempDir / (tempName + "." + stage);
+		std::filesystem::path output = tempDir / (tempName + ".spv");
+		std::filesystem::path log = tempDir / (tempName + ".log");
+
+		{
+			std::ofstream out(input, std::ios::out | std::ios::binary | std::ios::trunc);
+			out << source;
+		}
+
+		// Started directly with an argument list, no shell parses the configured path or the file names
+		int result = Util::RunProcess({ m_compiler, std::string(CompilerFlags), "-S", stage, input.string(), "-o", output.string() }, log.string(), m_compilerTimeoutMs);
+
+		std::vector<uint8_t> spirv;
+		if (result == 0) {
+			std::ifstream in(output, std::ios::in | std::ios::binary);
+			spirv.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+			LOG_RENDER_INFO("VKShaderCache: Compiled '{}' ({} bytes SPIR-V).", name, spirv.size());
+		}
+		else {
+			std::ifstream in(log);
+			std::stringstream messages;
+			messages << in.rdbuf();
+			if (result == -1)
+				LOG_RENDER_ERROR("VKShaderCache: Compiling '{}' failed, '{}' did not start, crashed or ran longer than {} ms:\n{}", name, m_compiler, m_compilerTimeoutMs, messages.str());
+			else
+				LOG_RENDER_ERROR("VKShaderCache: Compiling '{}' failed ({}):\n{}", name, result, messages.str());
+		}
+
+		std::error_code ec;
+		std::filesystem::remove(input, ec);
+		std::filesystem::remove(output, ec);
+		std::filesystem::remove(log, ec);
+		return spirv;
+	}
+
+
+	bool VKShaderCache::ExpandIncludes(const std::string& path, std::string& out, uint32_t depth)
+	{
+		if (depth > MaxIncludeDepth) {
+			LOG_RENDER_ERROR("VKShaderCache: Includes nested deeper than {} at '{}' (include cycle?).", MaxIncludeDepth, path);
+			return false;
+		}
+
+		std::string text = VirtFS.ReadText(path);
+		if (text.empty()) {
+			LOG_RENDER_ERROR("VKShaderCache: Failed to read GLSL source '{}'.", path);
+			return false;
+		}
+
+		// Relative to the including file, the compiler itself only sees the temporary copy
+		const std::string parent = VFS::VirtualFileSystem::GetParentPath(path);
+		std::istringstream lines(text);
+		std::string line;
+		uint32_t lineNumber = 0;
+		while (std::getline(lines, line)) {
+			lineNumber++;
+			std::string_view include = ParseInclude(line);
+			if (include.empty()) {
+				out += line;
+				out += '\n';
+				continue;
+			}
+
+			std::string includePath = parent.empty() ? std::string(include) : parent + "/" + std::string(include);
+			if (!ExpandIncludes(includePath, out, depth + 1)) {
+				LOG_RENDER_ERROR("VKShaderCache: Included from '{}' line {}.", path, lineNumber);
+				return false;
+			}
+			// Compiler messages keep the line numbers of this file
+			out += fmt::format("#line {}\n", lineNumber + 1);
+		}
+		return true;
+	}
+
+
+	uint64_t VKShaderCache::GetCompilerHash()
+	{
+		// Queried once per run, the version text changes with every compiler release
+		std::call_once(m_compilerHashOnce, [this] {
+			std::filesystem::path log = std::filesystem::temp_directory_path() / fmt::format("helios_{}_version.log",
+				std::hash<std::thread::id>{}(std::this_thread::get_id()));
+			std::string version;
+			if (Util::RunProcess({ m_compiler, "--version" }, log.string(), m_compilerTimeoutMs) == 0) {
+				std::ifstream in(log);
+				std::stringstream text;
+				text << in.rdbuf();
+				version = text.str();
+			}
+			std::error_code ec;
+			std::filesystem::remove(log, ec);
+
+			m_compilerHash = Util::HashFnv1a(CompilerFlags, Util::HashFnv1a(version, Util::HashFnv1a(m_compiler)));
+			LOG_RENDER_DEBUG("VKShaderCache: Compiler '{}' ({}).", m_compiler, version.empty() ? "version unknown" : version.substr(0, version.find('\n')));
+		});
+		return m_compilerHash;
+	}
+
+
+	std::string VKShaderCache::GetStage(const std::string& path)
+	{
+		// simple.vert.glsl -> vert
+		std::string name = VFS::VirtualFileSystem::GetFileName(path);
+		size_t end = name.rfind('.');
+		if (end == std::string::npos || end == 0)
+			return {};
+		size_t begin = name.rfind('.', end - 1);
+		if (begin == std::string::npos)
+			return {};
+
+		std::string stage = name.substr(begin + 1, end - begin - 1);
+		static const std::unordered_set<std::string> s_stages = { "vert", "frag", "comp", "geom", "tesc", "tese" };
+		return s_stages.count(stage) ? stage : std::string();
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
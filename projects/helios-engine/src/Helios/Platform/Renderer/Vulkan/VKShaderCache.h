@@ -0,0 +1,122 @@
+//==============================================================================
+// Vulkan Shader Module Cache
+//
+// Keeps vk::ShaderModules alive for reuse instead of reading and creating them
+// again for every pipeline build. Modules are keyed by a hash of their SPIR-V
+// content, so equal code loaded from different paths shares one module, and
+// the path -> hash mapping is remembered so repeated requests do not touch the
+// VFS at all. GLSL sources (*.vert.glsl, *.frag.glsl, ...) can be loaded
+// directly: they are compiled with glslangValidator once and the SPIR-V blob is
+// stored in the user cache, keyed by the hash of the source text (with its
+// includes) and the compiler.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Content-hashed vk::ShaderModule cache (lives until Clear/destruction).
+// - Path memo, Invalidate(path) forces a reload (e.g. after a file change).
+// - Modules no path maps to any more are retired, the owner destroys them
+//   once no pipeline build can still use them (TakeRetired).
+// - Cooked SPIR-V cache for GLSL sources in @cache:/shaders/<hash>.spv.
+// - #include "file" (relative to the including file) is inlined before
+//   compiling, so an edited include changes the cooked cache key.
+// - Hit/miss/compile statistics.
+//
+// Notes:
+// - The compiler is taken from renderer_vulkan/ShaderCache/Compiler, default
+//   glslangValidator from VULKAN_SDK (or PATH). It is started directly with
+//   an argument list (no shell) and killed after
+//   renderer_vulkan/ShaderCache/CompilerTimeoutMs.
+// - The compiler version (--version output) is queried once per run for the
+//   cooked cache key.
+// - Hot reload watches the top-level sources only, a changed include is
+//   picked up with the next change or load of a file that includes it.
+// - Thread-safe.
+//
+// Changelog:
+// - 2026.10: Invalidate retires the superseded module instead of leaking it
+// - 2026.10: Cooked cache key covers included files, compiler version and flags
+// - 2026.10: Compiler started without a shell (Util::RunProcess), with a timeout
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	struct VKShaderModuleInfo {
+		vk::ShaderModule Module = nullptr;
+		uint64_t Hash = 0; // SPIR-V content hash
+	};
+
+
+	class VKShaderCache
+	{
+	public:
+		VKShaderCache(const VKDeviceManager& deviceManager);
+		~VKShaderCache();
+
+		// Prevent copying and moving
+		VKShaderCache(const VKShaderCache&) = delete;
+		VKShaderCache& operator=(const VKShaderCache&) = delete;
+		VKShaderCache(VKShaderCache&&) = delete;
+		VKShaderCache& operator=(VKShaderCache&&) = delete;
+
+		// Module for a SPIR-V (*.spv) or GLSL (*.glsl) file, throws if it cannot be loaded
+		VKShaderModuleInfo GetModule(const std::string& path);
+
+		// SPIR-V for a GLSL source file (cooked cache or compiler), empty on failure
+		std::vector<uint8_t> CompileGlsl(const std::string& path);
+
+		// Forget the path mapping, the next GetModule reads the file again.
+		// A module no other path maps to is retired: it stays valid for builds
+		// that already hold it, until the owner takes it with TakeRetired.
+		void Invalidate(const std::string& path);
+
+		// Retired modules are appended in order, so the first GetRetiredCount()
+		// entries read before checking that no build is pending are safe to destroy
+		size_t GetRetiredCount();
+		void TakeRetired(size_t count, std::vector<vk::ShaderModule>& out);
+
+		// Destroys all modules, retired ones included (no pipeline creation may be in progress)
+		void Clear();
+
+		// --- Statistics ---
+		uint64_t GetHits() const { return m_hits.load(std::memory_order_relaxed); }
+		uint64_t GetMisses() const { return m_misses.load(std::memory_order_relaxed); }
+		uint64_t GetCompiles() const { return m_compiles.load(std::memory_order_relaxed); }
+
+	private:
+		std::vector<uint8_t> RunCompiler(const std::string& source, const std::string& stage, const std::string& name);
+		bool ExpandIncludes(const std::string& path, std::string& out, uint32_t depth); // appends the source with includes inlined
+		uint64_t GetCompilerHash(); // compiler path, version and flags
+		static std::string GetStage(const std::string& path); // "vert", "frag", ... from *.<stage>.glsl
+
+	private:
+		std::mutex m_mutex;
+		std::unordered_map<uint64_t, vk::ShaderModule> m_modules; // content hash -> module
+		std::unordered_map<std::string, uint64_t> m_pathHashes;   // path -> content hash
+		std::vector<vk::ShaderModule> m_retired;                  // unmapped by Invalidate, oldest first
+		std::string m_compiler;
+		uint32_t m_compilerTimeoutMs = 30000;
+		std::once_flag m_compilerHashOnce;
+		uint64_t m_compilerHash = 0;
+
+		std::atomic<uint64_t> m_hits = 0;
+		std::atomic<uint64_t> m_misses = 0;
+		std::atomic<uint64_t> m_compiles = 0;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
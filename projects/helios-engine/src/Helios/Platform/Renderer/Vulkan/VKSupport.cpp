@@ -19,12 +19,12 @@ namespace Helios::Engine::Renderer::Vulkan
 
 		std::call_once(s_flag, []()
 		{
-			// Initialize GLFW and check for Vulkan support
-			if (!glfwInit()) {
-				s_result = false;
-				return;
-			}
-			if (!glfwVulkanSupported()) {
+			// Initialize GLFW and check for Vulkan support. Without a display
+			// GLFW cannot initialize, headless rendering still only needs the loader.
+			bool glfwReady = glfwInit();
+			if (!glfwReady)
+				LOG_RENDER_INFO("GLFW could not be initialized, only headless Vulkan rendering is available.");
+			if (glfwReady && !glfwVulkanSupported()) {
 				s_result = false;
 				LOG_RENDER_INFO("Vulkan is not supported (GLFW reports no support).");
 				return;
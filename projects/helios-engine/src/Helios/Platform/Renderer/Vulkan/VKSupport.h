@@ -10,6 +10,7 @@
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Vulkan is reported without GLFW (headless)
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
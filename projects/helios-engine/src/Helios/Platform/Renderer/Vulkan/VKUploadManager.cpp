@@ -0,0 +1,292 @@
+//==============================================================================
+// Vulkan Upload Manager (implementation)
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Further information in the corresponding header file VKUploadManager.h
+//==============================================================================
+#include "pch.h"
+#include "Helios/Platform/Renderer/Vulkan/VKUploadManager.h"
+
+#include "Helios/Platform/Renderer/Vulkan/VKDeviceManager.h"
+
+#include "Helios/Engine/Core/Config.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	namespace {
+
+		constexpr vk::DeviceSize StagingAlignment = 16;
+
+	} // anonymous namespace
+
+
+	VKUploadManager::VKUploadManager(const VKDeviceManager& deviceManager, uint32_t framesInFlight)
+		: m_deviceManager(deviceManager)
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		m_graphicsFamily = m_deviceManager.GetGraphicsQueueIndex();
+		m_transferFamily = m_deviceManager.GetQueueFamilyIndices().transfer.value_or(m_graphicsFamily);
+		m_ownershipTransfer = (m_transferFamily != m_graphicsFamily);
+
+		// Everything that reads uploaded buffers waits, color output of the frame can start earlier
+		m_waitStages = vk::PipelineStageFlagBits::eDrawIndirect | vk::PipelineStageFlagBits::eVertexInput |
+			vk::PipelineStageFlagBits::eVertexShader | vk::PipelineStageFlagBits::eFragmentShader;
+
+		int stagingMB = std::clamp(ConfigManager::GetInstance().Get<int>("renderer_vulkan", "Upload", "StagingSizeMB", 16), 1, 1024);
+		m_ring = CreateScope<VKBuffer>(m_deviceManager, BufferType::Staging, static_cast<vk::DeviceSize>(stagingMB) << 20, MemoryUsage::Upload);
+
+		vk::CommandPoolCreateInfo poolInfo = vk::CommandPoolCreateInfo()
+			.setFlags(vk::CommandPoolCreateFlagBits::eResetCommandBuffer | vk::CommandPoolCreateFlagBits::eTransient)
+			.setQueueFamilyIndex(m_transferFamily);
+		m_commandPool = logicalDevice.createCommandPool(poolInfo);
+
+		vk::CommandBufferAllocateInfo allocInfo = vk::CommandBufferAllocateInfo()
+			.setCommandPool(m_commandPool)
+			.setLevel(vk::CommandBufferLevel::ePrimary)
+			.setCommandBufferCount(std::max(framesInFlight, 1u));
+		std::vector<vk::CommandBuffer> commandBuffers = logicalDevice.allocateCommandBuffers(allocInfo);
+
+		m_frames.resize(commandBuffers.size());
+		for (size_t i = 0; i < m_frames.size(); i++) {
+			m_frames[i].CommandBuffer = commandBuffers[i];
+			m_frames[i].Fence = logicalDevice.createFence(vk::FenceCreateInfo());
+			m_frames[i].Semaphore = logicalDevice.createSemaphore(vk::SemaphoreCreateInfo());
+		}
+
+		LOG_RENDER_DEBUG("VKUploadManager: Created ({} MiB staging ring, transfer family {}, {}).", stagingMB, m_transferFamily,
+			m_ownershipTransfer ? "queue family ownership transfer" : "shared with graphics");
+	}
+
+
+	VKUploadManager::~VKUploadManager()
+	{
+		WaitIdle();
+
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		for (auto& frame : m_frames) {
+			logicalDevice.destroySemaphore(frame.Semaphore);
+			logicalDevice.destroyFence(frame.Fence);
+		}
+		m_frames.clear();
+		logicalDevice.destroyCommandPool(m_commandPool);
+
+		m_pendingTempBuffers.clear();
+		m_ring.reset();
+		LOG_RENDER_DEBUG("VKUploadManager: Destroyed.");
+	}
+
+
+	void VKUploadManager::Upload(const VKBuffer& destination, const void* data, vk::DeviceSize size, vk::DeviceSize destinationOffset)
+	{
+		if (size == 0)
+			return;
+		if (destinationOffset + size > destination.GetSize()) {
+			LOG_RENDER_EXCEPT("VKUploadManager: Upload of {} bytes at offset {} exceeds the buffer size {}.", size, destinationOffset, destination.GetSize());
+		}
+
+		// Mapped destinations need no copy on the GPU
+		if (destination.IsHostVisible()) {
+			const_cast<VKBuffer&>(destination).Write(data, size, destinationOffset);
+			return;
+		}
+
+		PendingCopy copy;
+		copy.Destination = destination.Get();
+		copy.DestinationAccess = VKBuffer::GetReadAccess(destination.GetType());
+		copy.Region = vk::BufferCopy().setDstOffset(destinationOffset).setSize(size);
+
+		std::lock_guard lock(m_mutex);
+
+		vk::DeviceSize ringOffset = 0;
+		if (AllocateRing(size, ringOffset)) {
+			std::memcpy(static_cast<uint8_t*>(m_ring->GetMapped()) + ringOffset, data, static_cast<size_t>(size));
+			m_deviceManager.GetMemoryAllocator().Flush(m_ring->GetAllocation(), ringOffset, size);
+			copy.Source = m_ring->Get();
+			copy.Region.setSrcOffset(ringOffset);
+		}
+		else {
+			// Too big for the ring, or the ring is still in use by earlier batches
+			auto staging = CreateScope<VKBuffer>(m_deviceManager, BufferType::Staging, size, MemoryUsage::Upload);
+			staging->Write(data, size);
+			copy.Source = staging->Get();
+			copy.Region.setSrcOffset(0);
+			m_pendingTempBuffers.push_back(std::move(staging));
+
+			if (m_overflowCount.fetch_add(1, std::memory_order_relaxed) == 0)
+				LOG_RENDER_WARN("VKUploadManager: Staging ring full, using temporary staging buffers (upload of {} bytes).", size);
+		}
+
+		m_pending.push_back(copy);
+	}
+
+
+	bool VKUploadManager::AllocateRing(vk::DeviceSize size, vk::DeviceSize& offset)
+	{
+		const vk::DeviceSize capacity = m_ring->GetSize();
+
+		// Free space starts at the head and wraps around, padding counts as used until its batch is done
+		vk::DeviceSize aligned = (m_ringHead + StagingAlignment - 1) / StagingAlignment * StagingAlignment;
+		vk::DeviceSize padding = aligned - m_ringHead;
+		if (aligned + size > capacity) {
+			padding = capacity - m_ringHead;
+			aligned = 0;
+		}
+		if (m_ringUsed + padding + size > capacity)
+			return false;
+
+		offset = aligned;
+		m_ringHead = (aligned + size == capacity) ? 0 : aligned + size;
+		m_ringUsed += padding + size;
+		m_pendingRingBytes += padding + size;
+		return true;
+	}
+
+
+	void VKUploadManager::BeginFrame(uint32_t frame)
+	{
+		Recycle(m_frames[frame % m_frames.size()]);
+	}
+
+
+	void VKUploadManager::Recycle(FrameData& data)
+	{
+		// The batch that used this slot is done (the graphics frame waiting for it is), reclaim its staging memory
+		if (data.Submitted) {
+			(void)m_deviceManager.GetLogicalDevice().waitForFences(1, &data.Fence, VK_TRUE, UINT64_MAX);
+			data.Submitted = false;
+		}
+
+		std::lock_guard lock(m_mutex);
+		m_ringUsed -= data.RingBytes;
+		data.RingBytes = 0;
+		data.TempBuffers.clear();
+	}
+
+
+	vk::Semaphore VKUploadManager::Submit(uint32_t frame, vk::CommandBuffer graphicsCommandBuffer)
+	{
+		HE_PROFILE_FUNCTION();
+
+		FrameData& data = m_frames[frame % m_frames.size()];
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+
+		// Usually done by BeginFrame already, then this is a no-op
+		Recycle(data);
+
+		std::vector<PendingCopy> copies;
+		{
+			std::lock_guard lock(m_mutex);
+			if (m_pending.empty()) {
+				m_lastBatchCopies = 0;
+				m_lastBatchBytes = 0;
+				return nullptr;
+			}
+
+			copies.swap(m_pending);
+			data.RingBytes = m_pendingRingBytes;
+			m_pendingRingBytes = 0;
+			data.TempBuffers.swap(m_pendingTempBuffers);
+		}
+
+		m_lastBatchCopies = static_cast<uint32_t>(copies.size());
+		m_lastBatchBytes = 0;
+		for (const auto& copy : copies)
+			m_lastBatchBytes += copy.Region.size;
+
+		// Transfer queue: copies, then release the written ranges to the graphics family
+		vk::CommandBuffer commandBuffer = data.CommandBuffer;
+		commandBuffer.reset();
+		commandBuffer.begin(vk::CommandBufferBeginInfo().setFlags(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+		RecordCopies(commandBuffer, copies);
+
+		std::vector<vk::BufferMemoryBarrier> barriers;
+		if (m_ownershipTransfer) {
+			barriers.reserve(copies.size());
+			for (const auto& copy : copies) {
+				barriers.push_back(vk::BufferMemoryBarrier()
+					.setSrcAccessMask(vk::AccessFlagBits::eTransferWrite)
+					.setDstAccessMask({})
+					.setSrcQueueFamilyIndex(m_transferFamily)
+					.setDstQueueFamilyIndex(m_graphicsFamily)
+					.setBuffer(copy.Destination)
+					.setOffset(copy.Region.dstOffset)
+					.setSize(copy.Region.size));
+			}
+			commandBuffer.pipelineBarrier(vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe, {}, {}, barriers, {});
+		}
+		commandBuffer.end();
+
+		vk::SubmitInfo submitInfo = vk::SubmitInfo()
+			.setCommandBufferCount(1)
+			.setPCommandBuffers(&commandBuffer)
+			.setSignalSemaphoreCount(1)
+			.setPSignalSemaphores(&data.Semaphore);
+		(void)logicalDevice.resetFences(1, &data.Fence);
+		m_deviceManager.GetTransferQueue().submit({ submitInfo }, data.Fence);
+		data.Submitted = true;
+
+		// Graphics queue: acquire the same ranges, ordered after the semaphore wait
+		if (m_ownershipTransfer) {
+			for (size_t i = 0; i < barriers.size(); i++) {
+				barriers[i]
+					.setSrcAccessMask({})
+					.setDstAccessMask(copies[i].DestinationAccess);
+			}
+			graphicsCommandBuffer.pipelineBarrier(m_waitStages, m_waitStages, {}, {}, barriers, {});
+		}
+
+		LOG_RENDER_TRACE("VKUploadManager: Frame {} batch submitted ({} copies, {} bytes).", frame, m_lastBatchCopies, m_lastBatchBytes);
+		return data.Semaphore;
+	}
+
+
+	void VKUploadManager::RecordCopies(vk::CommandBuffer commandBuffer, std::vector<PendingCopy>& copies) const
+	{
+		// One vkCmdCopyBuffer per source/destination pair
+		std::stable_sort(copies.begin(), copies.end(), [](const PendingCopy& a, const PendingCopy& b) {
+			if (a.Destination != b.Destination)
+				return a.Destination < b.Destination;
+			return a.Source < b.Source;
+		});
+
+		std::vector<vk::BufferCopy> regions;
+		for (size_t i = 0; i < copies.size(); i++) {
+			regions.push_back(copies[i].Region);
+			bool last = (i + 1 == copies.size()) || copies[i + 1].Destination != copies[i].Destination || copies[i + 1].Source != copies[i].Source;
+			if (last) {
+				commandBuffer.copyBuffer(copies[i].Source, copies[i].Destination, regions);
+				regions.clear();
+			}
+		}
+	}
+
+
+	void VKUploadManager::WaitIdle()
+	{
+		const vk::Device& logicalDevice = m_deviceManager.GetLogicalDevice();
+		for (auto& frame : m_frames) {
+			if (frame.Submitted) {
+				(void)logicalDevice.waitForFences(1, &frame.Fence, VK_TRUE, UINT64_MAX);
+				frame.Submitted = false;
+			}
+
+			std::lock_guard lock(m_mutex);
+			m_ringUsed -= frame.RingBytes;
+			frame.RingBytes = 0;
+			frame.TempBuffers.clear();
+		}
+	}
+
+
+	bool VKUploadManager::HasPendingUploads() const
+	{
+		std::lock_guard lock(m_mutex);
+		return !m_pending.empty();
+	}
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
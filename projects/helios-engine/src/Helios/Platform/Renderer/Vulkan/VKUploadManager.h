@@ -0,0 +1,127 @@
+//==============================================================================
+// Vulkan Upload Manager
+//
+// Streams data into device local buffers. Upload() copies the data into a
+// persistently mapped ring staging buffer right away and queues the GPU copy;
+// the renderer submits all queued copies of a frame as one batch on the
+// transfer queue, and the graphics submit of that frame waits for it.
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+//
+// Main Features:
+// - Ring staging buffer (renderer_vulkan/Upload/StagingSizeMB), space is
+//   reclaimed when the batch that used it has finished. Uploads that do not
+//   fit get a temporary staging buffer instead of stalling.
+// - One transfer queue submission per frame, copies into the same buffer are
+//   merged into one vkCmdCopyBuffer.
+// - Queue family ownership transfer (release on the transfer queue, acquire
+//   in the graphics command buffer) when transfer and graphics families
+//   differ, plain semaphore synchronization otherwise.
+//
+// Notes:
+// - Upload() is thread-safe, BeginFrame(), Submit() and WaitIdle() belong to the render thread.
+// - Uploads go to the next Submit(); the destination range must not be read by
+//   frames still in flight (static data, or per-frame regions).
+// - Host visible destinations are written directly, without staging.
+//
+// Changelog:
+// - 2026.10: BeginFrame() recycles a frame's staging memory right after the frame fence
+// - 2026.10: Initial version / start of version history
+//==============================================================================
+#pragma once
+
+#include "Helios/Platform/Renderer/Vulkan/VKBuffer.h"
+
+namespace Helios::Engine::Renderer::Vulkan {
+
+
+	class VKDeviceManager;
+
+
+	class VKUploadManager
+	{
+	public:
+		VKUploadManager(const VKDeviceManager& deviceManager, uint32_t framesInFlight);
+		~VKUploadManager();
+
+		// Prevent copying and moving
+		VKUploadManager(const VKUploadManager&) = delete;
+		VKUploadManager& operator=(const VKUploadManager&) = delete;
+		VKUploadManager(VKUploadManager&&) = delete;
+		VKUploadManager& operator=(VKUploadManager&&) = delete;
+
+		// Copies data to the staging memory now, the GPU copy happens with the next Submit
+		void Upload(const VKBuffer& destination, const void* data, vk::DeviceSize size, vk::DeviceSize destinationOffset = 0);
+
+		// Reclaims the staging memory (ring space, temporary buffers) of the batch 'frame' submitted last time.
+		// Call after the frame fence, together with the other per-frame resets.
+		void BeginFrame(uint32_t frame);
+
+		// Submits the queued copies on the transfer queue and records the matching acquire barriers into
+		// graphicsCommandBuffer (before any render pass). Call once per frame after the frame fence.
+		// Returns the semaphore the graphics submit has to wait for at GetWaitStages(), nullptr without uploads.
+		vk::Semaphore Submit(uint32_t frame, vk::CommandBuffer graphicsCommandBuffer);
+
+		// Blocks until all submitted batches are done
+		void WaitIdle();
+
+		// --- Accessors ---
+		vk::PipelineStageFlags GetWaitStages() const { return m_waitStages; }
+		bool UsesOwnershipTransfer() const { return m_ownershipTransfer; }
+		bool HasPendingUploads() const;
+		uint32_t GetLastBatchCopies() const { return m_lastBatchCopies; }
+		vk::DeviceSize GetLastBatchBytes() const { return m_lastBatchBytes; }
+		uint64_t GetOverflowCount() const { return m_overflowCount; } // uploads that needed a temporary staging buffer
+
+	private:
+		struct PendingCopy
+		{
+			vk::Buffer Source;
+			vk::Buffer Destination;
+			vk::BufferCopy Region;
+			vk::AccessFlags DestinationAccess;
+		};
+
+		struct FrameData
+		{
+			vk::CommandBuffer CommandBuffer;
+			vk::Fence Fence;
+			vk::Semaphore Semaphore;
+			bool Submitted = false;
+			vk::DeviceSize RingBytes = 0;                // released when the batch is done
+			std::vector<Scope<VKBuffer>> TempBuffers;    // staging buffers of oversized uploads
+		};
+
+		void Recycle(FrameData& data);
+		bool AllocateRing(vk::DeviceSize size, vk::DeviceSize& offset);
+		void RecordCopies(vk::CommandBuffer commandBuffer, std::vector<PendingCopy>& copies) const;
+
+	private:
+		Scope<VKBuffer> m_ring;
+		vk::DeviceSize m_ringHead = 0;
+		vk::DeviceSize m_ringUsed = 0;    // including padding at alignment and wrap
+		vk::DeviceSize m_pendingRingBytes = 0;
+
+		std::vector<PendingCopy> m_pending;
+		std::vector<Scope<VKBuffer>> m_pendingTempBuffers;
+		mutable std::mutex m_mutex;
+
+		std::vector<FrameData> m_frames;
+		vk::CommandPool m_commandPool;
+
+		uint32_t m_transferFamily = 0;
+		uint32_t m_graphicsFamily = 0;
+		bool m_ownershipTransfer = false;
+		vk::PipelineStageFlags m_waitStages;
+
+		uint32_t m_lastBatchCopies = 0;
+		vk::DeviceSize m_lastBatchBytes = 0;
+		std::atomic<uint64_t> m_overflowCount = 0;
+
+		// --- Dependencies ---
+		const VKDeviceManager& m_deviceManager;
+	};
+
+
+} // namespace Helios::Engine::Renderer::Vulkan
@@ -4,21 +4,16 @@ layout(push_constant) uniform PushConstants {
 	mat4 viewProjectionMatrix;
 } pushConstants;
 
-layout(location = 0) out vec3 fragColor;
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inColor;
 
-vec2 positions[3] = vec2[](
-	vec2(0.0, -0.5),
-	vec2(0.5, 0.5),
-	vec2(-0.5, 0.5)
-);
+// Per instance (binding 1), the mat4 takes locations 2-5
+layout(location = 2) in mat4 inTransform;
+layout(location = 6) in vec4 inInstanceColor;
 
-vec3 colors[3] = vec3[](
-	vec3(1.0, 0.0, 0.0),
-	vec3(0.0, 1.0, 0.0),
-	vec3(0.0, 0.0, 1.0)
-);
+layout(location = 0) out vec3 fragColor;
 
 void main() {
-	gl_Position = pushConstants.viewProjectionMatrix * vec4(positions[gl_VertexIndex], 0.0, 1.0);
-	fragColor = colors[gl_VertexIndex];
+	gl_Position = pushConstants.viewProjectionMatrix * inTransform * vec4(inPosition, 1.0);
+	fragColor = inColor * inInstanceColor.rgb;
 }
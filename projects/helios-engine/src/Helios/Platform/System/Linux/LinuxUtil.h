@@ -1 +1,33 @@
+//==============================================================================
+// Linux Platform Utilities
+//
+// Provides Linux-specific utility functions for platform operations:
+// executable path detection and running external tools (readlink, posix_spawn).
+// Part of the cross-platform abstraction layer with equivalent
+// implementations for the other platforms (see WinUtil.h).
+//
+// Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
+// Part of the Helios Project - https://github.com/pernicius/helios-project
+// 
+// Changelog:
+// - 2026.10: Added RunProcess (external tools without a shell)
+// - 2026.01: Initial version / start of version history
+//==============================================================================
 #pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Helios::Util {
+
+
+	std::string GetExecutablePath();
+
+	// Runs args[0] (searched in PATH) with the remaining arguments, no shell in between. stdout and
+	// stderr go to 'outputFile'. Returns the exit code, -1 if the process could not be started, did
+	// not exit normally or was killed after 'timeoutMs' milliseconds.
+	int RunProcess(const std::vector<std::string>& args, const std::string& outputFile, uint32_t timeoutMs);
+
+
+} // namespace Helios::Util
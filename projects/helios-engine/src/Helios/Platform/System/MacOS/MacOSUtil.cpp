@@ -8,6 +8,16 @@
 #include <limits.h>
 #include <string>
 
+#include <cerrno>
+#include <chrono>
+#include <thread>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+
 namespace Helios::Util {
 
 
@@ -27,4 +37,45 @@ namespace Helios::Util {
 	}
 
 
+	int RunProcess(const std::vector<std::string>& args, const std::string& outputFile, uint32_t timeoutMs)
+	{
+		if (args.empty())
+			return -1;
+
+		std::vector<char*> argv;
+		for (const std::string& arg : args)
+			argv.push_back(const_cast<char*>(arg.c_str()));
+		argv.push_back(nullptr);
+
+		posix_spawn_file_actions_t actions;
+		posix_spawn_file_actions_init(&actions);
+		posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, outputFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+		pid_t pid = 0;
+		int error = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), environ);
+		posix_spawn_file_actions_destroy(&actions);
+		if (error != 0)
+			return -1;
+
+		// waitpid has no timeout, poll until the deadline
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+		int status = 0;
+		while (true) {
+			pid_t result = waitpid(pid, &status, WNOHANG);
+			if (result == pid)
+				break;
+			if (result == -1 && errno != EINTR)
+				return -1;
+			if (std::chrono::steady_clock::now() >= deadline) {
+				kill(pid, SIGKILL);
+				waitpid(pid, &status, 0);
+				return -1;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		}
+		return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+	}
+
+
 } // namespace Helios::Util
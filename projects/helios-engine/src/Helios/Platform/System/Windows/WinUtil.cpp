@@ -16,6 +16,49 @@
 namespace Helios::Util {
 
 
+	namespace {
+
+		std::wstring ToWide(const std::string& text)
+		{
+			if (text.empty())
+				return {};
+			int size = MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), nullptr, 0);
+			std::wstring wide(static_cast<size_t>(size), L'\0');
+			MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), wide.data(), size);
+			return wide;
+		}
+
+
+		// Quoted so the child's argument parsing (CommandLineToArgvW rules) gets 'arg' back unchanged
+		void AppendArgument(std::wstring& commandLine, const std::wstring& arg)
+		{
+			if (!commandLine.empty())
+				commandLine += L' ';
+			if (!arg.empty() && arg.find_first_of(L" \t\n\v\"") == std::wstring::npos) {
+				commandLine += arg;
+				return;
+			}
+
+			commandLine += L'"';
+			for (auto it = arg.begin(); ; ++it) {
+				size_t backslashes = 0;
+				while (it != arg.end() && *it == L'\\') {
+					++it;
+					++backslashes;
+				}
+				if (it == arg.end()) {
+					commandLine.append(backslashes * 2, L'\\'); // the closing quote follows
+					break;
+				}
+				commandLine.append((*it == L'"') ? backslashes * 2 + 1 : backslashes, L'\\');
+				commandLine += *it;
+			}
+			commandLine += L'"';
+		}
+
+	} // anonymous namespace
+
+
 	std::string GetExecutablePath()
 	{
 		wchar_t wtemp[MAX_PATH] = { 0 };
@@ -29,4 +72,46 @@ namespace Helios::Util {
 	}
 
 
+	int RunProcess(const std::vector<std::string>& args, const std::string& outputFile, uint32_t timeoutMs)
+	{
+		if (args.empty())
+			return -1;
+
+		std::wstring commandLine;
+		for (const std::string& arg : args)
+			AppendArgument(commandLine, ToWide(arg));
+
+		// Inherited by the child as stdout and stderr
+		SECURITY_ATTRIBUTES security = { sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE };
+		HANDLE output = CreateFileW(ToWide(outputFile).c_str(), GENERIC_WRITE, FILE_SHARE_READ, &security, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (output == INVALID_HANDLE_VALUE)
+			return -1;
+
+		STARTUPINFOW startup = {};
+		startup.cb = sizeof(startup);
+		startup.dwFlags = STARTF_USESTDHANDLES;
+		startup.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+		startup.hStdOutput = output;
+		startup.hStdError = output;
+
+		PROCESS_INFORMATION process = {};
+		BOOL started = CreateProcessW(nullptr, commandLine.data(), nullptr, nullptr, TRUE, CREATE_NO_WINDOW, nullptr, nullptr, &startup, &process);
+		CloseHandle(output);
+		if (!started)
+			return -1;
+
+		DWORD exitCode = static_cast<DWORD>(-1);
+		if (WaitForSingleObject(process.hProcess, timeoutMs) == WAIT_OBJECT_0) {
+			GetExitCodeProcess(process.hProcess, &exitCode);
+		}
+		else {
+			TerminateProcess(process.hProcess, static_cast<UINT>(-1));
+			WaitForSingleObject(process.hProcess, INFINITE);
+		}
+		CloseHandle(process.hThread);
+		CloseHandle(process.hProcess);
+		return static_cast<int>(exitCode);
+	}
+
+
 } // namespace Helios::Util
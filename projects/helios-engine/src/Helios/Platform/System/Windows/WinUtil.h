@@ -3,24 +3,33 @@
 //
 // Provides Windows-specific utility functions for platform operations.
 // Currently implements executable path detection using Windows API
-// (GetModuleFileName). Additional platform-specific utilities can be added
-// here as needed. Part of the cross-platform abstraction layer with
-// equivalent implementations for Linux and macOS.
+// (GetModuleFileName) and running external tools (CreateProcess).
+// Additional platform-specific utilities can be added here as needed. Part
+// of the cross-platform abstraction layer with equivalent implementations
+// for Linux and macOS.
 //
 // Copyright (c) 2026 Lennart "Pernicius" Molnar. All rights reserved.
 // Part of the Helios Project - https://github.com/pernicius/helios-project
 // 
 // Changelog:
+// - 2026.10: Added RunProcess (external tools without a shell)
 // - 2026.01: Initial version / start of version history
 //==============================================================================
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Helios::Util {
 
 
 	std::string GetExecutablePath();
 
+	// Runs args[0] (searched in PATH) with the remaining arguments, no shell in between. stdout and
+	// stderr go to 'outputFile'. Returns the exit code, -1 if the process could not be started, did
+	// not exit normally or was killed after 'timeoutMs' milliseconds.
+	int RunProcess(const std::vector<std::string>& args, const std::string& outputFile, uint32_t timeoutMs);
+
 
 } // namespace Helios::Util